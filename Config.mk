@@ -25,8 +25,8 @@ SHRLIB          := # one is a dir, all srcs within will
 # Flags
 # =======
 CPPFLAGS        := # Precompiler Flags
-CXXFLAGS        := -std=c++14 -Wall -Wextra -Wpedantic -g
-LDFLAGS         := -g # Linker flags
+CXXFLAGS        := -std=c++14 -Wall -Wextra -Wpedantic -g -pthread
+LDFLAGS         := -g -pthread # Linker flags
 
 # Makeball list
 # ===============
@@ -0,0 +1,116 @@
+// Standard headers
+#include <chrono>
+#include <random>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/Generators.hpp"
+
+// Benchmarked header
+#include "graph/ContractionHierarchy.hpp"
+
+/*============================================================================*/
+
+// Road-like graph: a side x side grid with random weights on both
+// directions of its edges
+static graph::Graph randomGrid(graph::Key side) {
+  return graph::generateGridGraph(
+    side, side, std::uniform_real_distribution<graph::Weight>(1, 1000));
+}
+
+/*============================================================================*/
+
+static void BM_BuildContractionHierarchy(benchmark::State& state) {
+  auto graph = randomGrid(state.range_x());
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto hierarchy
+      = graph::buildContractionHierarchy<heap::ValueBinary>(graph);
+    benchmark::DoNotOptimize(hierarchy.num_edges());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * graph.size());
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_BuildContractionHierarchy)
+  ->RangeMultiplier(2)->Range(32, 256)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_DijkstraQueryOnGrid(benchmark::State& state) {
+  auto graph = randomGrid(state.range_x());
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0,
+                                                           graph.size()-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Binary>(graph, source, destination);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraQueryOnGrid)
+  ->RangeMultiplier(2)->Range(32, 256)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_ContractionHierarchyQueryOnGrid(benchmark::State& state) {
+  auto graph = randomGrid(state.range_x());
+  auto hierarchy = graph::buildContractionHierarchy<heap::ValueBinary>(graph);
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0,
+                                                           graph.size()-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = hierarchy.shortest_path<heap::Binary>(source, destination);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_ContractionHierarchyQueryOnGrid)
+  ->RangeMultiplier(2)->Range(32, 256)->UseManualTime();
+
+/*============================================================================*/
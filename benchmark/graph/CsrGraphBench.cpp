@@ -0,0 +1,78 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <string>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "graph/Graph.hpp"
+
+// Benchmarked header
+#include "graph/CsrGraph.hpp"
+
+/*============================================================================*/
+
+static void BM_GenerateRandomGraphAndConvertToCsr(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                     num_edges,
+                                                     max_weight,
+                                                     std::mt19937{}));
+    benchmark::DoNotOptimize(graph.num_edges());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_edges);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_GenerateRandomGraphAndConvertToCsr)
+  ->RangeMultiplier(4)->Range(256*1024, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_GenerateRandomCsrGraph(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_threads = state.range_y();
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto graph = graph::generateRandomCsrGraph(num_nodes, num_edges,
+                                               max_weight, 0, num_threads);
+    benchmark::DoNotOptimize(graph.num_edges());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_edges);
+  state.SetLabel(std::to_string(num_threads) + " threads");
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_GenerateRandomCsrGraph)
+  ->RangeMultiplier(4)->Ranges({{256*1024, 4*1024*1024}, {1, 16}})
+  ->UseManualTime();
+
+/*============================================================================*/
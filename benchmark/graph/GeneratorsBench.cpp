@@ -0,0 +1,132 @@
+// Standard headers
+#include <cmath>
+#include <chrono>
+#include <random>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/DAry.hpp"
+#include "heap/Binary.hpp"
+#include "heap/Pairing.hpp"
+#include "heap/Fibonacci.hpp"
+#include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Benchmarked header
+#include "graph/Generators.hpp"
+
+/*============================================================================*/
+
+// Minimum paths between random nodes, timing only the searches
+template<template<typename...> class PriorityQueue>
+static void minimumPathsBetweenRandomNodes(benchmark::State& state,
+                                           const graph::CsrGraph& graph) {
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0,
+                                                           graph.size()-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<PriorityQueue>(graph, source, destination);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*============================================================================*/
+
+template<template<typename...> class PriorityQueue>
+static void BM_DijkstraOnGridGraph(benchmark::State& state) {
+  auto side = static_cast<std::size_t>(std::sqrt(state.range_x()));
+
+  // Road-like: low degree, large diameter, uniform weights
+  graph::CsrGraph graph(graph::generateGridGraph(
+    side, side, std::uniform_real_distribution<graph::Weight>(1, 1000)));
+
+  minimumPathsBetweenRandomNodes<PriorityQueue>(state, graph);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGridGraph, heap::Binary)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGridGraph, heap::DAry4)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGridGraph, heap::Pairing)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGridGraph, heap::Fibonacci)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<template<typename...> class PriorityQueue>
+static void BM_DijkstraOnRmatGraph(benchmark::State& state) {
+  auto scale = static_cast<unsigned int>(std::log2(state.range_x()));
+  auto num_edges = 8*state.range_x();
+
+  // Social-like: power-law degrees, small diameter, skewed weights
+  graph::CsrGraph graph(graph::generateRmatGraph(
+    scale, num_edges, std::exponential_distribution<graph::Weight>(0.01)));
+
+  minimumPathsBetweenRandomNodes<PriorityQueue>(state, graph);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnRmatGraph, heap::Binary)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnRmatGraph, heap::DAry4)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnRmatGraph, heap::Pairing)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnRmatGraph, heap::Fibonacci)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<template<typename...> class PriorityQueue>
+static void BM_DijkstraOnGeometricGraph(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+
+  // Radius for an average degree of about 8
+  auto radius = std::sqrt(8 / (M_PI * num_nodes));
+
+  graph::CsrGraph graph(graph::generateGeometricGraph<std::mt19937>(
+    num_nodes, radius, 1000.0));
+
+  minimumPathsBetweenRandomNodes<PriorityQueue>(state, graph);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGeometricGraph, heap::Binary)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGeometricGraph, heap::DAry4)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGeometricGraph, heap::Pairing)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraOnGeometricGraph, heap::Fibonacci)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,111 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <fstream>
+
+// System headers
+#include <unistd.h>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "graph/Graph.hpp"
+#include "graph/TextGraph.hpp"
+
+// Benchmarked header
+#include "graph/MappedGraph.hpp"
+
+/*============================================================================*/
+
+static std::string temporaryPath() {
+  char name[] = "/tmp/heaps-graph-XXXXXX";
+  int fd = ::mkstemp(name);
+  if (fd >= 0) ::close(fd);
+  return name;
+}
+
+/*============================================================================*/
+
+static void BM_LoadGraphFromTextFile(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto path = temporaryPath();
+  {
+    std::ofstream os(path);
+    graph::writeGraph(os, graph::generateRandomGraph(num_nodes,
+                                                     num_edges,
+                                                     max_weight,
+                                                     std::mt19937{}));
+  }
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::ifstream is(path);
+    auto graph = graph::readGraph(is);
+    benchmark::DoNotOptimize(graph.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  std::remove(path.c_str());
+  state.SetItemsProcessed(state.iterations() * num_edges);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_LoadGraphFromTextFile)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_LoadGraphFromMappedFile(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto path = temporaryPath();
+  graph::saveGraph(graph::generateRandomGraph(num_nodes,
+                                              num_edges,
+                                              max_weight,
+                                              std::mt19937{}),
+                   path);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    graph::MappedGraph graph(path);
+
+    // Touch all edges, as a query exploring the whole graph would
+    graph::Weight total = 0;
+    for (graph::Key u = 0; u < graph.size(); u++)
+      for (const auto& edge : graph[u])
+        total += edge.weight;
+    benchmark::DoNotOptimize(total);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  std::remove(path.c_str());
+  state.SetItemsProcessed(state.iterations() * num_edges);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_LoadGraphFromMappedFile)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
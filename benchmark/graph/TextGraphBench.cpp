@@ -0,0 +1,135 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <sstream>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+
+// Benchmarked header
+#include "graph/TextGraph.hpp"
+
+/*============================================================================*/
+
+template<typename W>
+static std::string randomGraphText(std::size_t num_nodes, W max_weight) {
+  std::ostringstream os;
+  graph::writeGraph(os, graph::generateRandomGraph(num_nodes,
+                                                   2*num_nodes,
+                                                   max_weight,
+                                                   std::mt19937{}));
+  return os.str();
+}
+
+/*============================================================================*/
+
+template<typename W>
+static void BM_ParseGraphWithStreams(benchmark::State& state) {
+  auto text = randomGraphText(state.range_x(), W(1000));
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::istringstream is(text);
+    graph::BasicGraph<W> graph;
+    std::string line;
+    while (std::getline(is, line)) {
+      std::istringstream iss(line);
+      graph.emplace_back();
+      graph::BasicEdge<W> edge;
+      while (iss >> edge) graph.back().push_back(edge);
+    }
+    benchmark::DoNotOptimize(graph.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_ParseGraphWithStreams, double)
+  ->RangeMultiplier(8)->Range(4*1024, 1024*1024)->UseManualTime();
+BENCHMARK_TEMPLATE(BM_ParseGraphWithStreams, int)
+  ->RangeMultiplier(8)->Range(4*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename W>
+static void BM_ParseGraph(benchmark::State& state) {
+  auto text = randomGraphText(state.range_x(), W(1000));
+  auto num_threads = static_cast<unsigned int>(state.range_y());
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto graph = graph::parseGraph<W>(text.data(),
+                                      text.data() + text.size(),
+                                      num_threads);
+    benchmark::DoNotOptimize(graph.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_ParseGraph, double)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 1024*1024}, {1, 8}})
+  ->UseManualTime();
+BENCHMARK_TEMPLATE(BM_ParseGraph, int)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 1024*1024}, {1, 8}})
+  ->UseManualTime();
+
+/*============================================================================*/
+
+template<typename W>
+static void BM_ParseCsrGraph(benchmark::State& state) {
+  auto text = randomGraphText(state.range_x(), W(1000));
+  auto num_threads = static_cast<unsigned int>(state.range_y());
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto graph = graph::parseCsrGraph<W>(text.data(),
+                                         text.data() + text.size(),
+                                         num_threads);
+    benchmark::DoNotOptimize(graph.num_edges());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_ParseCsrGraph, double)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 1024*1024}, {1, 8}})
+  ->UseManualTime();
+BENCHMARK_TEMPLATE(BM_ParseCsrGraph, int)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 1024*1024}, {1, 8}})
+  ->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,137 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <unordered_set>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/Landmarks.hpp"
+
+// Benchmarked header
+#include "graph/astar.hpp"
+
+/*============================================================================*/
+
+// Binary heap counting the nodes settled by the searches using it: with
+// lazy insertion, the first entry popped for a node settles it, while
+// later ones are stale (the landmark heuristic is consistent)
+template<typename K, typename Comparator = std::less<K>>
+class CountingBinary : public heap::ValueBinary<K, Comparator> {
+ public:
+  static std::size_t settled;
+
+  K delete_minimum() {
+    auto minimum = heap::ValueBinary<K, Comparator>::delete_minimum();
+    if (popped.insert(minimum.key).second) settled++;
+    return minimum;
+  }
+
+ private:
+  std::unordered_set<graph::Key> popped;
+};
+
+template<typename K, typename Comparator>
+std::size_t CountingBinary<K, Comparator>::settled = 0;
+
+using CountingQueue = CountingBinary<graph::Edge>;
+
+static std::string settledLabel(std::size_t settled, std::size_t queries) {
+  return "settled/query=" + std::to_string(settled / queries);
+}
+
+/*============================================================================*/
+
+static void BM_DijkstraPointToPoint(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  CountingQueue::settled = 0;
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path
+      = graph::dijkstra<CountingBinary>(graph, source, destination);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetLabel(settledLabel(CountingQueue::settled, state.iterations()));
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraPointToPoint)
+  ->RangeMultiplier(8)->Range(4*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_AStarPointToPointWithLandmarks(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_landmarks = state.range_y();
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+  auto landmarks = graph::buildLandmarks<heap::Binary>(graph, num_landmarks);
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  CountingQueue::settled = 0;
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::astar<CountingBinary>(
+      graph, source, destination, landmarks.heuristic(destination));
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetLabel(settledLabel(CountingQueue::settled, state.iterations()));
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_AStarPointToPointWithLandmarks)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 1024*1024}, {4, 16}})
+  ->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,121 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Benchmarked header
+#include "graph/batchDijkstra.hpp"
+
+/*============================================================================*/
+
+// Batch with 8 destinations per source, in random order
+static std::vector<std::pair<graph::Key, graph::Key>> randomQueries(
+    graph::Key num_nodes, int num_queries, std::mt19937& rng) {
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  std::vector<graph::Key> sources;
+  for (int i = 0; i < num_queries / 8; i++)
+    sources.push_back(node_generator(rng));
+
+  std::uniform_int_distribution<std::size_t> source_generator(
+    0, sources.size()-1);
+
+  std::vector<std::pair<graph::Key, graph::Key>> queries;
+  for (int i = 0; i < num_queries; i++)
+    queries.emplace_back(sources[source_generator(rng)], node_generator(rng));
+  return queries;
+}
+
+/*============================================================================*/
+
+static void BM_BatchOfQueriesOneByOne(benchmark::State& state) {
+  auto num_nodes = 16*1024;
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_queries = state.range_x();
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+
+  while (state.KeepRunning()) {
+    auto queries = randomQueries(num_nodes, num_queries, rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto& query : queries) {
+      auto path = graph::dijkstra<heap::Binary>(graph,
+                                                query.first, query.second);
+      benchmark::DoNotOptimize(path.data());
+    }
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_queries);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_BatchOfQueriesOneByOne)
+  ->Arg(64)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_BatchOfQueriesGroupedBySource(benchmark::State& state) {
+  auto num_nodes = 16*1024;
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_queries = state.range_x();
+  auto num_threads = state.range_y();
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+
+  while (state.KeepRunning()) {
+    auto queries = randomQueries(num_nodes, num_queries, rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto paths = graph::batchDijkstra<heap::Binary>(graph, queries,
+                                                    num_threads);
+    benchmark::DoNotOptimize(paths.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_queries);
+  state.SetLabel(std::to_string(num_threads) + " threads");
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_BatchOfQueriesGroupedBySource)
+  ->RangeMultiplier(2)->Ranges({{64, 64}, {1, 8}})->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,100 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <string>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Benchmarked header
+#include "graph/deltaStepping.hpp"
+
+/*============================================================================*/
+
+static void BM_MinimumDistancesWithDijkstra(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto tree = graph::shortestPathTree<heap::Binary>(graph, source);
+    benchmark::DoNotOptimize(tree.distance.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_MinimumDistancesWithDijkstra)
+  ->RangeMultiplier(4)->Range(64*1024, 1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_MinimumDistancesWithDeltaStepping(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_threads = state.range_y();
+
+  // Max weight divided by the average degree
+  auto delta = max_weight / 4;
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto distances = graph::deltaStepping(graph, source, delta, num_threads);
+    benchmark::DoNotOptimize(distances.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+  state.SetLabel(std::to_string(num_threads) + " threads");
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_MinimumDistancesWithDeltaStepping)
+  ->RangeMultiplier(4)->Ranges({{64*1024, 1024*1024}, {1, 16}})
+  ->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,204 @@
+// Standard headers
+#include <chrono>
+#include <random>
+#include <vector>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
+
+// Benchmarked header
+#include "graph/dijkstra.hpp"
+
+/*============================================================================*/
+
+static void BM_MinimumPathsToManyDestinationsOneByOne(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_destinations = state.range_y();
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    std::vector<graph::Key> destinations;
+    for (int i = 0; i < num_destinations; i++)
+      destinations.push_back(node_generator(rng));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto destination : destinations) {
+      auto path = graph::dijkstra<heap::Binary>(graph, source, destination);
+      benchmark::DoNotOptimize(path.data());
+    }
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_destinations);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_MinimumPathsToManyDestinationsOneByOne)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 256*1024}, {1, 64}})
+  ->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_MinimumPathsToManyDestinationsWithTree(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+  auto num_destinations = state.range_y();
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  graph::ShortestPathTree tree;
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    std::vector<graph::Key> destinations;
+    for (int i = 0; i < num_destinations; i++)
+      destinations.push_back(node_generator(rng));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    tree.source = source;
+    graph::shortestPathTree<heap::Binary>(graph, source,
+                                          tree.distance, tree.parent);
+    for (auto destination : destinations) {
+      auto path = tree.path_to(destination);
+      benchmark::DoNotOptimize(path.data());
+    }
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_destinations);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_MinimumPathsToManyDestinationsWithTree)
+  ->RangeMultiplier(8)->Ranges({{4*1024, 256*1024}, {1, 64}})
+  ->UseManualTime();
+
+/*============================================================================*/
+
+// Nearby destination, reached through a few lightest edges, such that
+// only a small region around the source is explored
+static graph::Key nearbyNode(const graph::CsrGraph& graph, graph::Key u) {
+  for (int hop = 0; hop < 2 && !graph[u].empty(); hop++) {
+    auto lightest = *graph[u].begin();
+    for (const auto& edge : graph[u])
+      if (edge.weight < lightest.weight) lightest = edge;
+    u = lightest.key;
+  }
+  return u;
+}
+
+/*============================================================================*/
+
+static void BM_LocalQueriesAllocatingBuffers(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = nearbyNode(graph, source);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Binary>(graph, source, destination);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_LocalQueriesAllocatingBuffers)
+  ->RangeMultiplier(8)->Range(64*1024, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_LocalQueriesReusingWorkspace(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 4*num_nodes;
+  auto max_weight = 1000.0;
+
+  graph::CsrGraph graph(graph::generateRandomGraph(num_nodes,
+                                                   num_edges,
+                                                   max_weight,
+                                                   std::mt19937{}));
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<graph::Key> node_generator(0, num_nodes-1);
+
+  graph::DijkstraWorkspace<heap::Binary> workspace(graph.size());
+
+  while (state.KeepRunning()) {
+    auto source = node_generator(rng);
+    auto destination = nearbyNode(graph, source);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra(graph, source, destination, workspace);
+    benchmark::DoNotOptimize(path.data());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_LocalQueriesReusingWorkspace)
+  ->RangeMultiplier(8)->Range(64*1024, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
@@ -2,15 +2,19 @@
 #include <cmath>
 #include <chrono>
 #include <random>
+#include <cstdint>
 #include <vector>
 #include <iostream>
+#include <algorithm>
 
 // External headers
 #include "benchmark/benchmark.h"
 
 // Internal headers
 #include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
 #include "graph/dijkstra.hpp"
+#include "graph/GraphCache.hpp"
 
 // Benchmarked header
 #include "heap/Binary.hpp"
@@ -22,15 +26,43 @@ static void BM_DijkstraMinimumPathWithBinaryHeap(benchmark::State& state) {
   auto num_edges = 2*num_nodes;
   auto max_weight = 1000.0;
 
-  unsigned int i = 0;
+  // Generated once, outside the timed loop, and shared with the
+  // benchmarks of other heaps
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
   while (state.KeepRunning()) {
-    // state.PauseTiming();
-    auto graph = graph::generateRandomGraph(num_nodes,
-                                            num_edges,
-                                            max_weight,
-                                            std::mt19937{i++});
-    // state.ResumeTiming();
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Binary>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithBinaryHeap)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
 
+/*============================================================================*/
+
+template<typename W>
+static void BM_DijkstraMinimumPathWithBinaryHeapOnCsrGraph(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::BasicCsrGraph<W>(
+    *graph::sharedGraphCache().random_graph(
+      num_nodes, num_edges, max_weight, 0));
+
+  while (state.KeepRunning()) {
     auto start = std::chrono::high_resolution_clock::now();
     auto path = graph::dijkstra<heap::Binary>(graph, 0, num_nodes-1);
     auto end   = std::chrono::high_resolution_clock::now();
@@ -45,7 +77,216 @@ static void BM_DijkstraMinimumPathWithBinaryHeap(benchmark::State& state) {
 
 /*----------------------------------------------------------------------------*/
 
-BENCHMARK(BM_DijkstraMinimumPathWithBinaryHeap)
+BENCHMARK_TEMPLATE(BM_DijkstraMinimumPathWithBinaryHeapOnCsrGraph, double)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraMinimumPathWithBinaryHeapOnCsrGraph, float)
   ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
 
+BENCHMARK_TEMPLATE(BM_DijkstraMinimumPathWithBinaryHeapOnCsrGraph, uint32_t)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_BidirectionalDijkstraMinimumPathWithBinaryHeap(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+  auto reverse = graph::reverseGraph(*graph);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::bidirectionalDijkstra<heap::Binary>(
+      *graph, reverse, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_BidirectionalDijkstraMinimumPathWithBinaryHeap)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_DijkstraMinimumPathWithValueBinaryHeap(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::ValueBinary>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithValueBinaryHeap)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_DijkstraMinimumPathWithBinaryHeapAndDecreaseKey(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Binary, graph::DecreaseKey>(
+      *graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithBinaryHeapAndDecreaseKey)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_DecreaseKeyWithBinaryHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    heap::Binary<int> bin;
+    std::vector<heap::Binary<int>::node_ptr> nodes;
+    for (int j = 0; j < num_nodes; j++)
+      nodes.push_back(bin.insert(key_generator(rng)));
+
+    std::shuffle(nodes.begin(), nodes.end(), rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto& node : nodes)
+      bin.decrease_key(node, node->key / 2);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DecreaseKeyWithBinaryHeap)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_InsertOneByOneWithBinaryHeap(benchmark::State& state) {
+  auto num_keys = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    std::vector<int> keys;
+    for (int j = 0; j < num_keys; j++)
+      keys.push_back(key_generator(rng));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Heap bin;
+    for (auto key : keys)
+      bin.insert(key);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_keys);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_InsertOneByOneWithBinaryHeap, heap::Binary<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_InsertOneByOneWithBinaryHeap, heap::ValueBinary<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_InsertBulkWithBinaryHeap(benchmark::State& state) {
+  auto num_keys = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    std::vector<int> keys;
+    for (int j = 0; j < num_keys; j++)
+      keys.push_back(key_generator(rng));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Heap bin(keys);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_keys);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_InsertBulkWithBinaryHeap, heap::Binary<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_InsertBulkWithBinaryHeap, heap::ValueBinary<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
 /*============================================================================*/
@@ -0,0 +1,159 @@
+// Standard headers
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <numeric>
+#include <algorithm>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/GraphCache.hpp"
+
+// Benchmarked header
+#include "heap/DAry.hpp"
+
+/*============================================================================*/
+
+template<template<typename...> class Heap, typename Strategy>
+static void BM_DijkstraMinimumPathWithDAryHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<Heap, Strategy>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithDAryHeap,
+                    heap::DAry4, graph::LazyInsertion)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithDAryHeap,
+                    heap::DAry8, graph::LazyInsertion)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithDAryHeap,
+                    heap::DAry4, graph::DecreaseKey)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_DecreaseKeyWithDAryHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    Heap dary;
+    std::vector<typename Heap::node_ptr> nodes;
+    std::vector<int> keys;
+    for (int j = 0; j < num_nodes; j++) {
+      keys.push_back(key_generator(rng));
+      nodes.push_back(dary.insert(keys.back()));
+    }
+
+    std::vector<int> order(num_nodes);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto j : order)
+      dary.decrease_key(nodes[j], keys[j] / 2);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithDAryHeap, heap::DAry4<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithDAryHeap, heap::DAry8<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+// Same order as std::less, but hides it from the SIMD specializations
+struct ScalarLess {
+  bool operator()(double lhs, double rhs) const { return lhs < rhs; }
+};
+
+/*----------------------------------------------------------------------------*/
+
+template<typename Heap>
+static void BM_DeleteMinimumWithDAryHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_deletions = std::min<decltype(num_nodes)>(num_nodes, 1024*1024);
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_real_distribution<double> key_generator(0.0, 1000.0);
+
+    Heap dary;
+    for (int j = 0; j < num_nodes; j++)
+      dary.insert(key_generator(rng));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int j = 0; j < num_deletions; j++)
+      benchmark::DoNotOptimize(dary.delete_minimum());
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_deletions);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DeleteMinimumWithDAryHeap, heap::DAry8<double>)
+  ->RangeMultiplier(8)->Range(1024*1024, 100*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DeleteMinimumWithDAryHeap, heap::DAry16<double>)
+  ->RangeMultiplier(8)->Range(1024*1024, 100*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DeleteMinimumWithDAryHeap,
+                   heap::DAry<double, ScalarLess, 8>)
+  ->RangeMultiplier(8)->Range(1024*1024, 100*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DeleteMinimumWithDAryHeap,
+                   heap::DAry<double, ScalarLess, 16>)
+  ->RangeMultiplier(8)->Range(1024*1024, 100*1024*1024)->UseManualTime();
+
+/*============================================================================*/
@@ -4,6 +4,7 @@
 #include <random>
 #include <vector>
 #include <iostream>
+#include <algorithm>
 
 // External headers
 #include "benchmark/benchmark.h"
@@ -11,6 +12,7 @@
 // Internal headers
 #include "graph/Graph.hpp"
 #include "graph/dijkstra.hpp"
+#include "graph/GraphCache.hpp"
 
 // Benchmarked header
 #include "heap/Fibonacci.hpp"
@@ -22,17 +24,12 @@ static void BM_DijkstraMinimumPathWithFibonacciHeap(benchmark::State& state) {
   auto num_edges = 2*num_nodes;
   auto max_weight = 1000.0;
 
-  unsigned int i = 0;
-  while (state.KeepRunning()) {
-    // state.PauseTiming();
-    auto graph = graph::generateRandomGraph(num_nodes,
-                                            num_edges,
-                                            max_weight,
-                                            std::mt19937{i++});
-    // state.ResumeTiming();
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
 
+  while (state.KeepRunning()) {
     auto start = std::chrono::high_resolution_clock::now();
-    auto path = graph::dijkstra<heap::Fibonacci>(graph, 0, num_nodes-1);
+    auto path = graph::dijkstra<heap::Fibonacci>(*graph, 0, num_nodes-1);
     auto end   = std::chrono::high_resolution_clock::now();
 
     auto elapsed_seconds =
@@ -49,3 +46,105 @@ BENCHMARK(BM_DijkstraMinimumPathWithFibonacciHeap)
   ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
 
 /*============================================================================*/
+
+static void BM_DijkstraMinimumPathWithFibonacciHeapAndDecreaseKey(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(
+      *graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithFibonacciHeapAndDecreaseKey)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+static void BM_DijkstraMinimumPathWithArenaFibonacciHeap(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::ArenaFibonacci>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithArenaFibonacciHeap)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_DecreaseKeyWithFibonacciHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    Heap fib;
+    std::vector<typename Heap::node_ptr> nodes;
+    for (int j = 0; j < num_nodes; j++)
+      nodes.push_back(fib.insert(key_generator(rng)));
+
+    fib.insert(-1);
+    fib.delete_minimum();  // To consolidate trees
+    std::shuffle(nodes.begin(), nodes.end(), rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto& node : nodes)
+      fib.decrease_key(node, node->key / 2);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithFibonacciHeap, heap::Fibonacci<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithFibonacciHeap, heap::ArenaFibonacci<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
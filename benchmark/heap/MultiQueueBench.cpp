@@ -0,0 +1,97 @@
+// Standard headers
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+
+// Benchmarked header
+#include "heap/MultiQueue.hpp"
+
+/*============================================================================*/
+
+// Binary heap shared through a global lock, with the same concurrent
+// interface of the multiqueue
+template<typename K>
+class LockedBinary {
+ public:
+  void insert(K key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    heap.insert(key);
+  }
+
+  bool try_delete_minimum(K& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (heap.empty()) return false;
+    key = heap.delete_minimum();
+    return true;
+  }
+
+ private:
+  std::mutex mutex;
+  heap::ValueBinary<K> heap;
+};
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_ConcurrentInsertAndDeleteMinimum(benchmark::State& state) {
+  auto num_threads = state.range_x();
+  auto operations_per_thread = 100000;
+  auto initial_size = 100000;
+
+  while (state.KeepRunning()) {
+    Heap queue;
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> key_generator(0, 1 << 30);
+    for (int i = 0; i < initial_size; i++)
+      queue.insert(key_generator(rng));
+
+    // Each thread alternates between inserting and deleting keys, as
+    // workers of a scheduler producing and consuming tasks
+    auto work = [&queue, operations_per_thread](unsigned int seed) {
+      std::mt19937 rng(seed);
+      std::uniform_int_distribution<int> key_generator(0, 1 << 30);
+      int key;
+      for (int i = 0; i < operations_per_thread; i += 2) {
+        queue.insert(key_generator(rng));
+        queue.try_delete_minimum(key);
+      }
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++)
+      threads.emplace_back(work, t);
+    for (auto& thread : threads)
+      thread.join();
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(
+    state.iterations() * num_threads * operations_per_thread);
+  state.SetLabel(std::to_string(num_threads) + " threads");
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_ConcurrentInsertAndDeleteMinimum, LockedBinary<int>)
+  ->RangeMultiplier(2)->Range(1, 16)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_ConcurrentInsertAndDeleteMinimum, heap::MultiQueue<int>)
+  ->RangeMultiplier(2)->Range(1, 16)->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,101 @@
+// Standard headers
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/GraphCache.hpp"
+
+// Benchmarked header
+#include "heap/Pairing.hpp"
+
+/*============================================================================*/
+
+template<template<typename...> class Heap, typename Strategy>
+static void BM_DijkstraMinimumPathWithPairingHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<Heap, Strategy>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithPairingHeap,
+                    heap::Pairing, graph::LazyInsertion)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithPairingHeap,
+                    heap::Pairing, graph::DecreaseKey)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE2(BM_DijkstraMinimumPathWithPairingHeap,
+                    heap::ArenaPairing, graph::DecreaseKey)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<typename Heap>
+static void BM_DecreaseKeyWithPairingHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+
+  unsigned int i = 0;
+  while (state.KeepRunning()) {
+    std::mt19937 rng{i++};
+    std::uniform_int_distribution<int> key_generator(0, 1000*1000*1000);
+
+    Heap pairing;
+    std::vector<typename Heap::node_ptr> nodes;
+    for (int j = 0; j < num_nodes; j++)
+      nodes.push_back(pairing.insert(key_generator(rng)));
+
+    pairing.insert(-1);
+    pairing.delete_minimum();  // To pair trees
+    std::shuffle(nodes.begin(), nodes.end(), rng);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto& node : nodes)
+      pairing.decrease_key(node, node->key / 2);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithPairingHeap, heap::Pairing<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DecreaseKeyWithPairingHeap, heap::ArenaPairing<int>)
+  ->RangeMultiplier(4)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
@@ -0,0 +1,85 @@
+// Standard headers
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+// External headers
+#include "benchmark/benchmark.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/GraphCache.hpp"
+
+// Benchmarked header
+#include "heap/Radix.hpp"
+
+/*============================================================================*/
+
+static void BM_DijkstraMinimumPathWithRadixHeap(benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<heap::Radix>(*graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK(BM_DijkstraMinimumPathWithRadixHeap)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
+
+template<template<typename...> class Heap>
+static void BM_DijkstraMinimumPathWithIntegerWeights(
+    benchmark::State& state) {
+  auto num_nodes = state.range_x();
+  auto num_edges = 2*num_nodes;
+  auto max_weight = 1000.0;
+
+  auto graph = *graph::sharedGraphCache().random_graph(
+    num_nodes, num_edges, max_weight, 0);
+  for (auto& edges : graph)
+    for (auto& edge : edges)
+      edge.weight = std::round(edge.weight);
+
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto path = graph::dijkstra<Heap>(graph, 0, num_nodes-1);
+    auto end   = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+        end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BENCHMARK_TEMPLATE(BM_DijkstraMinimumPathWithIntegerWeights, heap::Radix)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+BENCHMARK_TEMPLATE(BM_DijkstraMinimumPathWithIntegerWeights, heap::Binary)
+  ->RangeMultiplier(2)->Range(512, 4*1024*1024)->UseManualTime();
+
+/*============================================================================*/
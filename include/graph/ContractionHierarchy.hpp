@@ -0,0 +1,513 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_CONTRACTION_HIERARCHY_
+#define GRAPH_CONTRACTION_HIERARCHY_
+
+// Standard headers
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+
+namespace graph {
+
+/**
+ * @class BasicContractionHierarchy
+ * @brief Graph whose nodes were contracted one by one in order of
+ *        importance, adding shortcuts that preserve minimum paths, so
+ *        queries only need to search upward from both endpoints
+ */
+template<typename W>
+class BasicContractionHierarchy {
+ public:
+  // Inner structs
+
+  /**
+   * @class Arc
+   * @brief Edge to a node with higher rank, which is a shortcut for
+   *        the path through middle unless middle is InvalidKey
+   */
+  struct Arc {
+    Key node;
+    W weight;
+    Key middle;
+  };
+
+  // Constructors
+  BasicContractionHierarchy() : up_offsets(1, 0), down_offsets(1, 0) {
+  }
+
+  /**
+   * @param ranks Position of each node in the contraction order
+   * @param up_offsets Positions where the arcs of each node start in
+   *                   up_arcs, followed by the number of arcs
+   * @param up_arcs Arcs u->v leaving each node u
+   * @param down_offsets Positions where the arcs of each node start in
+   *                     down_arcs, followed by the number of arcs
+   * @param down_arcs Arcs v->u entering each node u, stored with node v
+   */
+  BasicContractionHierarchy(std::vector<Key> ranks,
+                            std::vector<std::size_t> up_offsets,
+                            std::vector<Arc> up_arcs,
+                            std::vector<std::size_t> down_offsets,
+                            std::vector<Arc> down_arcs)
+      : ranks(std::move(ranks)),
+        up_offsets(std::move(up_offsets)), up_arcs(std::move(up_arcs)),
+        down_offsets(std::move(down_offsets)),
+        down_arcs(std::move(down_arcs)) {
+    assert(this->up_offsets.size() == this->ranks.size() + 1);
+    assert(this->down_offsets.size() == this->ranks.size() + 1);
+  }
+
+  // Concrete methods
+
+  /**
+   * Find minimum path between two nodes of the graph with two upward
+   * searches, one from each endpoint, and unpack its shortcuts
+   * @tparam PriorityQueue Heap used to select the next node to be
+   *         visited (with lazy insertion) in each direction
+   * @param source Node where the path starts
+   * @param destination Node where the path ends
+   * @return Nodes of the minimum path, from source to destination
+   */
+  template<template<typename...> class PriorityQueue>
+  std::vector<Key> shortest_path(const Key& source,
+                                 const Key& destination) const {
+    assert(source < size());
+    assert(destination < size());
+
+    using Entry = BasicEdge<W>;
+
+    std::vector<W> forward_d(size(), infinity<W>());
+    std::vector<W> backward_d(size(), infinity<W>());
+    std::vector<const Arc*> forward_arc(size(), nullptr);
+    std::vector<const Arc*> backward_arc(size(), nullptr);
+    std::vector<Key> forward_parent(size(), InvalidKey);
+    std::vector<Key> backward_parent(size(), InvalidKey);
+
+    PriorityQueue<Entry, std::less<Entry>> forward_Q, backward_Q;
+
+    forward_d[source] = 0;
+    backward_d[destination] = 0;
+    forward_Q.insert(Entry{source, 0});
+    backward_Q.insert(Entry{destination, 0});
+
+    W best = infinity<W>();
+    Key meeting = InvalidKey;
+
+    while (true) {
+      bool forward = !forward_Q.empty()
+        && forward_Q.find_minimum().weight < best;
+      bool backward = !backward_Q.empty()
+        && backward_Q.find_minimum().weight < best;
+      if (!forward && !backward) break;
+
+      if (forward && backward)
+        forward = forward_Q.find_minimum() <= backward_Q.find_minimum();
+
+      if (forward)
+        settle_next(forward_Q, up_offsets, up_arcs,
+                    forward_d, forward_parent, forward_arc,
+                    backward_d, best, meeting);
+      else
+        settle_next(backward_Q, down_offsets, down_arcs,
+                    backward_d, backward_parent, backward_arc,
+                    forward_d, best, meeting);
+    }
+
+    std::vector<Key> path(1, source);
+    if (meeting == InvalidKey) return path;
+
+    // Arcs of the path as (start, arc), which is stored with its end
+    std::vector<std::pair<Key, Arc>> arcs;
+    for (Key p = meeting; p != source; p = forward_parent[p])
+      arcs.emplace_back(forward_parent[p], *forward_arc[p]);
+    std::reverse(arcs.begin(), arcs.end());
+    for (Key p = meeting; p != destination; p = backward_parent[p]) {
+      auto arc = *backward_arc[p];
+      arc.node = backward_parent[p];
+      arcs.emplace_back(p, arc);
+    }
+
+    for (const auto& arc : arcs)
+      unpack(arc.first, arc.second, path);
+
+    return path;
+  }
+
+  /**
+   * @return Number of nodes of the graph
+   */
+  std::size_t size() const {
+    return ranks.size();
+  }
+
+  /**
+   * @return Number of edges of the graph, including shortcuts
+   */
+  std::size_t num_edges() const {
+    return up_arcs.size() + down_arcs.size();
+  }
+
+  /**
+   * @param u Node of the graph
+   * @return Position of u in the contraction order
+   */
+  Key rank(const Key& u) const {
+    return ranks[u];
+  }
+
+ private:
+  // Instance variables
+  std::vector<Key> ranks;
+  std::vector<std::size_t> up_offsets;
+  std::vector<Arc> up_arcs;
+  std::vector<std::size_t> down_offsets;
+  std::vector<Arc> down_arcs;
+
+  // Concrete methods
+
+  /**
+   * Settle the next node of one of the upward searches, updating the
+   * best path whenever the node was reached by the other search
+   */
+  template<typename Queue>
+  static void settle_next(Queue& Q,
+                          const std::vector<std::size_t>& offsets,
+                          const std::vector<Arc>& arcs,
+                          std::vector<W>& d,
+                          std::vector<Key>& parent,
+                          std::vector<const Arc*>& parent_arc,
+                          const std::vector<W>& other_d,
+                          W& best, Key& meeting) {
+    using Entry = BasicEdge<W>;
+
+    auto min = Q.find_minimum();
+    auto u = min.key;
+    Q.delete_minimum();
+    if (min.weight > d[u]) return;
+
+    if (other_d[u] != infinity<W>() && d[u] + other_d[u] < best) {
+      best = d[u] + other_d[u];
+      meeting = u;
+    }
+
+    for (auto i = offsets[u]; i < offsets[u+1]; i++) {
+      const auto& arc = arcs[i];
+      if (d[arc.node] > d[u] + arc.weight) {
+        d[arc.node] = d[u] + arc.weight;
+        parent[arc.node] = u;
+        parent_arc[arc.node] = &arc;
+        Q.insert(Entry{arc.node, d[arc.node]});
+      }
+    }
+  }
+
+  /**
+   * @return Lightest arc between node and other in the given direction
+   */
+  static const Arc& find_arc(const std::vector<std::size_t>& offsets,
+                             const std::vector<Arc>& arcs,
+                             const Key& node, const Key& other) {
+    const Arc* lightest = nullptr;
+    for (auto i = offsets[node]; i < offsets[node+1]; i++)
+      if (arcs[i].node == other
+          && (!lightest || arcs[i].weight < lightest->weight))
+        lightest = &arcs[i];
+    assert(lightest != nullptr);
+    return *lightest;
+  }
+
+  /**
+   * Append the nodes of an arc leaving from the end of a path, after
+   * replacing its shortcuts by the paths they represent
+   */
+  void unpack(const Key& from, const Arc& arc, std::vector<Key>& path) const {
+    // Arcs still to be unpacked, the next one on the top
+    std::vector<std::pair<Key, Arc>> pending(1, std::make_pair(from, arc));
+
+    while (!pending.empty()) {
+      auto u = pending.back().first;
+      auto a = pending.back().second;
+      pending.pop_back();
+
+      if (a.middle == InvalidKey) {
+        path.push_back(a.node);
+        continue;
+      }
+
+      // The middle node was contracted before both ends of the shortcut
+      auto m = a.middle;
+      pending.emplace_back(m, find_arc(up_offsets, up_arcs, m, a.node));
+      pending.emplace_back(u, find_arc(down_offsets, down_arcs, m, u));
+      pending.back().second.node = m;
+    }
+  }
+};
+
+using ContractionHierarchy = BasicContractionHierarchy<Weight>;
+
+namespace detail {
+
+/**
+ * @class Contraction
+ * @brief Graph where nodes are contracted one by one, replacing the
+ *        paths through them by shortcuts unless witness searches find
+ *        other paths at most as short
+ *
+ * Once a node is contracted, its arcs are removed from its neighbors,
+ * so the remaining graph only has uncontracted nodes, while the arcs
+ * of the node itself are frozen: they all lead to nodes with higher
+ * rank, which is what the upward searches of the queries need.
+ */
+template<template<typename...> class PriorityQueue, typename W>
+class Contraction {
+ public:
+  // Aliases
+  using Arc = typename BasicContractionHierarchy<W>::Arc;
+
+  // Static variables
+  static constexpr std::size_t max_settled = 500;
+  static constexpr std::size_t max_simulated_settled = 50;
+
+  // Constructors
+  template<typename GraphType>
+  explicit Contraction(const GraphType& G)
+      : out(G.size()), in(G.size()), deleted(G.size(), 0),
+        witness_d(G.size(), infinity<W>()),
+        witness_target(G.size(), false) {
+    for (Key u = 0; u < G.size(); u++)
+      for (const auto& edge : G[u])
+        if (edge.key != u) add_arc(u, edge.key, edge.weight, InvalidKey);
+  }
+
+  // Concrete methods
+
+  /**
+   * Contract all nodes, always choosing the one whose contraction adds
+   * fewer shortcuts than it removes edges, spread over the graph
+   * @return Hierarchy with the contracted graph
+   */
+  BasicContractionHierarchy<W> build() {
+    using Entry = BasicEdge<long>;
+
+    auto n = out.size();
+
+    std::vector<Entry> priorities;
+    for (Key v = 0; v < n; v++)
+      priorities.push_back(Entry{v, priority(v)});
+    heap::ValueBinary<Entry> Q(priorities);
+
+    std::vector<Key> ranks(n);
+    Key rank = 0;
+
+    // Priorities are updated lazily, when their nodes reach the top
+    while (!Q.empty()) {
+      auto v = Q.delete_minimum().key;
+      auto p = priority(v);
+      if (!Q.empty() && p > Q.find_minimum().weight) {
+        Q.insert(Entry{v, p});
+        continue;
+      }
+
+      contract(v, max_settled, false);
+      ranks[v] = rank++;
+
+      for (const auto& arc : out[v]) {
+        deleted[arc.node]++;
+        remove_arcs(in[arc.node], v);
+      }
+      for (const auto& arc : in[v]) {
+        deleted[arc.node]++;
+        remove_arcs(out[arc.node], v);
+      }
+    }
+
+    std::vector<std::size_t> up_offsets(1, 0), down_offsets(1, 0);
+    std::vector<Arc> up_arcs, down_arcs;
+
+    for (Key u = 0; u < n; u++) {
+      up_arcs.insert(up_arcs.end(), out[u].begin(), out[u].end());
+      down_arcs.insert(down_arcs.end(), in[u].begin(), in[u].end());
+      up_offsets.push_back(up_arcs.size());
+      down_offsets.push_back(down_arcs.size());
+    }
+
+    return BasicContractionHierarchy<W>(
+      std::move(ranks),
+      std::move(up_offsets), std::move(up_arcs),
+      std::move(down_offsets), std::move(down_arcs));
+  }
+
+ private:
+  // Instance variables
+  std::vector<std::vector<Arc>> out;
+  std::vector<std::vector<Arc>> in;
+  std::vector<long> deleted;
+
+  std::vector<W> witness_d;
+  std::vector<bool> witness_target;
+  std::vector<Key> witness_touched;
+
+  // Concrete methods
+
+  /**
+   * Add arc u->v, or make the existing one lighter
+   */
+  void add_arc(Key u, Key v, W weight, Key middle) {
+    for (auto& arc : out[u]) {
+      if (arc.node != v) continue;
+      if (weight < arc.weight) {
+        arc = Arc{v, weight, middle};
+        for (auto& reverse_arc : in[v])
+          if (reverse_arc.node == u) reverse_arc = Arc{u, weight, middle};
+      }
+      return;
+    }
+    out[u].push_back(Arc{v, weight, middle});
+    in[v].push_back(Arc{u, weight, middle});
+  }
+
+  /**
+   * Remove arcs to node v
+   */
+  static void remove_arcs(std::vector<Arc>& arcs, Key v) {
+    arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+                              [v](const Arc& arc) { return arc.node == v; }),
+               arcs.end());
+  }
+
+  /**
+   * @return Priority of contracting v: its edge difference (shortcuts
+   *         added minus edges removed) plus its contracted neighbors
+   */
+  long priority(Key v) {
+    auto shortcuts = contract(v, max_simulated_settled, true);
+    long edges = out[v].size() + in[v].size();
+    return static_cast<long>(shortcuts) - edges + deleted[v];
+  }
+
+  /**
+   * Replace paths u->v->x through v by shortcuts u->x, when necessary
+   * @param v Node to be contracted
+   * @param limit Maximum number of nodes settled by witness searches
+   * @param simulate Whether shortcuts should only be counted
+   * @return Number of shortcuts
+   */
+  std::size_t contract(Key v, std::size_t limit, bool simulate) {
+    std::size_t shortcuts = 0;
+
+    for (const auto& in_arc : in[v]) {
+      auto u = in_arc.node;
+
+      W max_weight = 0;
+      std::size_t targets = 0;
+      for (const auto& out_arc : out[v]) {
+        if (out_arc.node == u) continue;
+        max_weight = std::max<W>(max_weight, in_arc.weight + out_arc.weight);
+        witness_target[out_arc.node] = true;
+        targets++;
+      }
+      if (targets == 0) continue;
+
+      witness_search(u, v, max_weight, limit, targets);
+
+      for (const auto& out_arc : out[v]) {
+        auto x = out_arc.node;
+        if (x == u) continue;
+        auto weight = in_arc.weight + out_arc.weight;
+        witness_target[x] = false;
+        if (witness_d[x] > weight) {
+          shortcuts++;
+          if (!simulate) add_arc(u, x, weight, v);
+        }
+      }
+
+      for (auto w : witness_touched) witness_d[w] = infinity<W>();
+      witness_touched.clear();
+    }
+
+    return shortcuts;
+  }
+
+  /**
+   * Find distances from source up to max_weight avoiding the node
+   * excluded, settling at most limit nodes and stopping as soon as
+   * all the targets are settled
+   */
+  void witness_search(Key source, Key excluded, W max_weight,
+                      std::size_t limit, std::size_t targets) {
+    using Entry = BasicEdge<W>;
+
+    PriorityQueue<Entry, std::less<Entry>> Q;
+
+    witness_d[source] = 0;
+    witness_touched.push_back(source);
+    Q.insert(Entry{source, 0});
+
+    std::size_t settled = 0;
+    while (!Q.empty() && settled < limit) {
+      auto min = Q.delete_minimum();
+      auto u = min.key;
+      if (min.weight > witness_d[u]) continue;
+      if (min.weight > max_weight) break;
+      if (witness_target[u] && --targets == 0) break;
+      settled++;
+
+      for (const auto& arc : out[u]) {
+        auto x = arc.node;
+        if (x == excluded) continue;
+        if (witness_d[x] > witness_d[u] + arc.weight) {
+          if (witness_d[x] == infinity<W>()) witness_touched.push_back(x);
+          witness_d[x] = witness_d[u] + arc.weight;
+          Q.insert(Entry{x, witness_d[x]});
+        }
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/**
+ * Preprocess a graph, contracting its nodes to speed up queries
+ * @tparam PriorityQueue Heap used by the witness searches
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @return Contraction hierarchy of the graph
+ */
+template<template<typename...> class PriorityQueue,
+         typename GraphType>
+BasicContractionHierarchy<WeightOf<GraphType>> buildContractionHierarchy(
+    const GraphType& G) {
+  return detail::Contraction<PriorityQueue, WeightOf<GraphType>>(G).build();
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_CONTRACTION_HIERARCHY_
@@ -0,0 +1,371 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_CSR_GRAPH_
+#define GRAPH_CSR_GRAPH_
+
+// Standard headers
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+
+namespace graph {
+
+/**
+ * @class BasicAdjacency
+ * @brief Read-only range over the edges leaving a vertex, whose targets
+ *        and weights are stored in separate contiguous arrays
+ */
+template<typename W>
+class BasicAdjacency {
+ public:
+  // Inner classes
+  class const_iterator {
+   public:
+    // Aliases
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = BasicEdge<W>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const BasicEdge<W>*;
+    using reference = BasicEdge<W>;
+
+    // Constructors
+    const_iterator(const Key* key, const W* weight)
+        : key(key), weight(weight) {
+    }
+
+    // Overloaded operators
+    BasicEdge<W> operator*() const {
+      return BasicEdge<W>{*key, *weight};
+    }
+
+    const_iterator& operator++() {
+      ++key;
+      ++weight;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator& lhs,
+                           const const_iterator& rhs) {
+      return lhs.key == rhs.key;
+    }
+
+    friend bool operator!=(const const_iterator& lhs,
+                           const const_iterator& rhs) {
+      return !operator==(lhs, rhs);
+    }
+
+   private:
+    // Instance variables
+    const Key* key;
+    const W* weight;
+  };
+
+  // Constructors
+  BasicAdjacency(const Key* keys, const W* weights, std::size_t num_edges)
+      : keys(keys), weights(weights), num_edges(num_edges) {
+  }
+
+  // Overloaded operators
+  BasicEdge<W> operator[](std::size_t i) const {
+    return BasicEdge<W>{keys[i], weights[i]};
+  }
+
+  // Concrete methods
+  const_iterator begin() const {
+    return const_iterator(keys, weights);
+  }
+
+  const_iterator end() const {
+    return const_iterator(keys + num_edges, weights + num_edges);
+  }
+
+  std::size_t size() const {
+    return num_edges;
+  }
+
+  bool empty() const {
+    return num_edges == 0;
+  }
+
+ private:
+  // Instance variables
+  const Key* keys;
+  const W* weights;
+  std::size_t num_edges;
+};
+
+using Adjacency = BasicAdjacency<Weight>;
+
+/**
+ * @class BasicCsrGraph
+ * @brief Graph in compressed sparse row format: the edges leaving vertex
+ *        u are stored in positions [offsets[u], offsets[u+1]) of the
+ *        targets and weights arrays, with weights of type W
+ */
+template<typename W>
+class BasicCsrGraph {
+ public:
+  // Constructors
+  BasicCsrGraph() : offsets(1, 0) {
+  }
+
+  /**
+   * Convert a graph stored as adjacency lists, possibly changing the
+   * type of its weights (see castWeight)
+   * @param graph Graph to be converted
+   */
+  template<typename V>
+  explicit BasicCsrGraph(const BasicGraph<V>& graph) : offsets(1, 0) {
+    offsets.reserve(graph.size() + 1);
+    for (const auto& edges : graph)
+      offsets.push_back(offsets.back() + edges.size());
+
+    targets.reserve(offsets.back());
+    weights.reserve(offsets.back());
+    for (const auto& edges : graph) {
+      for (const auto& edge : edges) {
+        targets.push_back(edge.key);
+        weights.push_back(castWeight<W>(edge.weight));
+      }
+    }
+  }
+
+  /**
+   * Take ownership of arrays already in compressed sparse row format
+   * @param offsets Positions where the edges of each vertex start,
+   *                followed by the number of edges
+   * @param targets Targets of the edges
+   * @param weights Weights of the edges
+   */
+  BasicCsrGraph(std::vector<std::size_t> offsets,
+                std::vector<Key> targets,
+                std::vector<W> weights)
+      : offsets(std::move(offsets)),
+        targets(std::move(targets)),
+        weights(std::move(weights)) {
+    assert(!this->offsets.empty());
+    assert(this->offsets.back() == this->targets.size());
+    assert(this->targets.size() == this->weights.size());
+  }
+
+  // Overloaded operators
+
+  /**
+   * @param u Vertex whose edges will be returned
+   * @return Range with the edges leaving u
+   */
+  BasicAdjacency<W> operator[](Key u) const {
+    return BasicAdjacency<W>(targets.data() + offsets[u],
+                     weights.data() + offsets[u],
+                     offsets[u+1] - offsets[u]);
+  }
+
+  // Concrete methods
+
+  /**
+   * @return Number of vertices of the graph
+   */
+  std::size_t size() const {
+    return offsets.size() - 1;
+  }
+
+  /**
+   * @return Number of edges of the graph
+   */
+  std::size_t num_edges() const {
+    return targets.size();
+  }
+
+ private:
+  // Instance variables
+  std::vector<std::size_t> offsets;
+  std::vector<Key> targets;
+  std::vector<W> weights;
+};
+
+using CsrGraph = BasicCsrGraph<Weight>;
+
+namespace detail {
+
+/**
+ * Run tasks 0 to num_tasks-1, taken on demand by a pool of threads
+ * @param num_tasks Number of tasks
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @param task Callable receiving the index of a task
+ */
+template<typename Task>
+void forEachTask(std::size_t num_tasks, unsigned int num_threads,
+                 Task task) {
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  auto num_workers = std::min<std::size_t>(
+    std::max(num_threads, 1u), num_tasks);
+
+  std::atomic<std::size_t> next(0);
+  auto work = [&next, &task, num_tasks] {
+    for (auto i = next++; i < num_tasks; i = next++)
+      task(i);
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < num_workers; i++)
+    threads.emplace_back(work);
+  work();
+
+  for (auto& thread : threads)
+    thread.join();
+}
+
+/**
+ * Create the generator of one of the random streams of a graph
+ * @param seed Seed of the whole graph
+ * @param stream Index of the stream
+ * @return Generator seeded by both values
+ */
+template<typename RandomNumberGenerator>
+RandomNumberGenerator streamGenerator(std::uint32_t seed,
+                                      std::uint32_t stream) {
+  std::seed_seq sequence { seed, stream };
+  return RandomNumberGenerator(sequence);
+}
+
+}  // namespace detail
+
+/**
+ * Generate a random graph directly in compressed sparse row format,
+ * with the same distribution of generateRandomGraph, using many threads
+ *
+ * Vertices are split in ranges, and the number of edges leaving each
+ * range is drawn by recursive binomial splits of all edges. Then edges
+ * of each range are drawn from their own random stream, seeded by the
+ * seed and the index of the range, and written in their final place.
+ * Hence, the same seed always yields the same graph, regardless of the
+ * number of threads.
+ *
+ * @param num_nodes Number of vertices
+ * @param num_edges Number of edges, whose sources and targets are drawn
+ *        uniformly (possibly repeated)
+ * @param max_weight Maximum weight, drawn uniformly from 0
+ * @param seed Seed of the random streams
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Random graph
+ */
+template<typename RandomNumberGenerator = std::mt19937, typename W = Weight>
+BasicCsrGraph<W> generateRandomCsrGraph(
+    std::size_t num_nodes, std::size_t num_edges, W max_weight,
+    std::uint32_t seed = RandomNumberGenerator::default_seed,
+    unsigned int num_threads = 0) {
+  assert((num_nodes == 0 && num_edges == 0)
+         || (num_edges <= num_nodes*(num_nodes-1)/2.0));
+
+  // Vertices whose edges are drawn by the same task
+  const std::size_t range_size = 1 << 12;
+
+  auto num_ranges = (num_nodes + range_size - 1) / range_size;
+  auto range_begin = [num_nodes, range_size](std::size_t range) {
+    return std::min(num_nodes, range * range_size);
+  };
+
+  // Split edges between the two halves of a set of ranges, as if each
+  // source were drawn uniformly (stream 0 is reserved for the splits)
+  std::vector<std::size_t> first_edge(num_ranges + 1, 0);
+  first_edge[num_ranges] = num_edges;
+  auto rng = detail::streamGenerator<RandomNumberGenerator>(seed, 0);
+  std::vector<std::pair<std::size_t, std::size_t>> pending;
+  if (num_ranges > 0) pending.emplace_back(0, num_ranges);
+  while (!pending.empty()) {
+    auto first = pending.back().first, last = pending.back().second;
+    pending.pop_back();
+    if (last - first < 2) continue;
+
+    auto middle = first + (last - first) / 2;
+    auto edges = first_edge[last] - first_edge[first];
+    auto fraction
+      = static_cast<double>(range_begin(middle) - range_begin(first))
+        / (range_begin(last) - range_begin(first));
+    std::binomial_distribution<std::size_t> split(edges, fraction);
+    first_edge[middle] = first_edge[first] + split(rng);
+
+    pending.emplace_back(middle, last);
+    pending.emplace_back(first, middle);
+  }
+
+  std::vector<std::size_t> offsets(num_nodes + 1, 0);
+  std::vector<Key> targets(num_edges);
+  std::vector<W> weights(num_edges);
+  offsets[num_nodes] = num_edges;
+
+  detail::forEachTask(num_ranges, num_threads, [&](std::size_t range) {
+    auto range_rng = detail::streamGenerator<RandomNumberGenerator>(
+      seed, range + 1);
+    auto first_node = range_begin(range), last_node = range_begin(range+1);
+    std::uniform_int_distribution<Key> source_generator(first_node,
+                                                        last_node-1);
+    std::uniform_int_distribution<Key> node_generator(0, num_nodes-1);
+    WeightDistribution<W> weight_generator(0, max_weight);
+
+    auto first = first_edge[range], last = first_edge[range+1];
+    std::vector<BasicEdge<W>> edges(last - first);
+    std::vector<Key> sources(last - first);
+    for (std::size_t i = 0; i < edges.size(); i++) {
+      sources[i] = source_generator(range_rng);
+      edges[i].key = node_generator(range_rng);
+      edges[i].weight = weight_generator(range_rng);
+    }
+
+    // Counting sort of the edges of the range by source
+    std::vector<std::size_t> cursor(last_node - first_node + 1, 0);
+    for (auto src : sources)
+      cursor[src - first_node + 1]++;
+    for (std::size_t u = 1; u < cursor.size(); u++)
+      cursor[u] += cursor[u-1];
+    for (auto u = first_node; u < last_node; u++)
+      offsets[u] = first + cursor[u - first_node];
+    for (std::size_t i = 0; i < edges.size(); i++) {
+      auto position = first + cursor[sources[i] - first_node]++;
+      targets[position] = edges[i].key;
+      weights[position] = edges[i].weight;
+    }
+  });
+
+  return BasicCsrGraph<W>(std::move(offsets), std::move(targets),
+                          std::move(weights));
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_CSR_GRAPH_
@@ -25,40 +25,49 @@
 
 namespace graph {
 
-struct Edge {
+/**
+ * @class BasicEdge
+ * @brief Edge to a node, with a weight of type W
+ */
+template<typename W>
+struct BasicEdge {
   Key key;
-  Weight weight;
+  W weight;
 
-  friend bool operator==(const Edge& lhs, const Edge& rhs) {
+  friend bool operator==(const BasicEdge& lhs, const BasicEdge& rhs) {
     return lhs.key == rhs.key && lhs.weight == rhs.weight;
   }
 
-  friend bool operator!=(const Edge& lhs, const Edge& rhs) {
+  friend bool operator!=(const BasicEdge& lhs, const BasicEdge& rhs) {
     return !operator==(lhs, rhs);
   }
 
-  friend bool operator<(const Edge& lhs, const Edge& rhs) {
+  friend bool operator<(const BasicEdge& lhs, const BasicEdge& rhs) {
     return lhs.weight < rhs.weight;
   }
 
-  friend bool operator<=(const Edge& lhs, const Edge& rhs) {
+  friend bool operator<=(const BasicEdge& lhs, const BasicEdge& rhs) {
     return operator==(lhs, rhs) || operator<(lhs, rhs);
   }
 
-  friend bool operator>(const Edge& lhs, const Edge& rhs) {
+  friend bool operator>(const BasicEdge& lhs, const BasicEdge& rhs) {
     return !operator<=(lhs, rhs);
   }
 
-  friend bool operator>=(const Edge& lhs, const Edge& rhs) {
+  friend bool operator>=(const BasicEdge& lhs, const BasicEdge& rhs) {
     return !operator<(lhs, rhs);
   }
 
-  friend std::ostream& operator<<(std::ostream& os, const Edge& e) {
+  friend W priority(const BasicEdge& e) {
+    return e.weight;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const BasicEdge& e) {
     os << "(" << e.key << "," << e.weight << ")";
     return os;
   }
 
-  friend std::istream& operator>>(std::istream& is, Edge& e) {
+  friend std::istream& operator>>(std::istream& is, BasicEdge& e) {
     char c;
     if (!(is >> c)) return is;
     if (c != '(') { is.setstate(is.failbit); return is; }
@@ -70,6 +79,8 @@ struct Edge {
   }
 };
 
+using Edge = BasicEdge<Weight>;
+
 }  // namespace graph
 
 #endif  // GRAPH_EDGE_
@@ -0,0 +1,180 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_GENERATORS_
+#define GRAPH_GENERATORS_
+
+// Standard headers
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+
+namespace graph {
+
+/**
+ * Generate a road-like graph: a grid whose neighbor vertices are linked
+ * in both directions, by edges with the same random weight
+ * @param rows Number of rows of the grid
+ * @param columns Number of columns of the grid
+ * @param weights Distribution of the weights, such as the uniform
+ *        WeightDistribution or std::exponential_distribution
+ * @param rng Random number generator
+ * @return Grid where vertex u is in row u / columns and column
+ *         u % columns
+ */
+template<typename Distribution,
+         typename RandomNumberGenerator = std::mt19937>
+BasicGraph<typename Distribution::result_type> generateGridGraph(
+    std::size_t rows, std::size_t columns, Distribution weights,
+    RandomNumberGenerator rng
+      = RandomNumberGenerator{ RandomNumberGenerator::default_seed }) {
+  using W = typename Distribution::result_type;
+
+  BasicGraph<W> graph(rows * columns);
+  Key width = columns;
+  auto link = [&](Key u, Key v) {
+    auto weight = weights(rng);
+    graph[u].push_back(BasicEdge<W>{v, weight});
+    graph[v].push_back(BasicEdge<W>{u, weight});
+  };
+
+  for (Key u = 0; u < graph.size(); u++) {
+    if ((u + 1) % width != 0) link(u, u + 1);
+    if (u + width < graph.size()) link(u, u + width);
+  }
+
+  return graph;
+}
+
+/**
+ * Generate a power-law graph with the R-MAT model, which places each
+ * edge in one of the quadrants of the adjacency matrix with probability
+ * a (top left), b (top right), c (bottom left) or 1-a-b-c (bottom
+ * right), recursively, until a single cell is left
+ * @param scale Logarithm of the number of vertices
+ * @param num_edges Number of edges (possibly repeated or loops)
+ * @param weights Distribution of the weights (see generateGridGraph)
+ * @param rng Random number generator
+ * @param a Probability of the top left quadrant
+ * @param b Probability of the top right quadrant
+ * @param c Probability of the bottom left quadrant
+ * @return Graph with 2^scale vertices, whose degrees follow a power law
+ *         for the default probabilities (Graph500 parameters)
+ */
+template<typename Distribution,
+         typename RandomNumberGenerator = std::mt19937>
+BasicGraph<typename Distribution::result_type> generateRmatGraph(
+    unsigned int scale, std::size_t num_edges, Distribution weights,
+    RandomNumberGenerator rng
+      = RandomNumberGenerator{ RandomNumberGenerator::default_seed },
+    double a = 0.57, double b = 0.19, double c = 0.19) {
+  using W = typename Distribution::result_type;
+
+  assert(scale < 8 * sizeof(Key));
+  assert(a >= 0 && b >= 0 && c >= 0 && a + b + c <= 1);
+
+  std::uniform_real_distribution<double> quadrant_generator(0, 1);
+
+  BasicGraph<W> graph(std::size_t(1) << scale);
+  for (std::size_t i = 0; i < num_edges; i++) {
+    Key src = 0, dst = 0;
+    for (unsigned int level = 0; level < scale; level++) {
+      auto p = quadrant_generator(rng);
+      src = 2 * src + (p >= a + b);
+      dst = 2 * dst + ((p >= a && p < a + b) || p >= a + b + c);
+    }
+    graph[src].push_back(BasicEdge<W>{dst, weights(rng)});
+  }
+
+  return graph;
+}
+
+/**
+ * Generate a random geometric graph, whose vertices are points drawn
+ * uniformly in the unit square, linked in both directions whenever
+ * their distance is at most radius
+ * @param num_nodes Number of vertices
+ * @param radius Maximum distance between linked points
+ * @param max_weight Weight of edges whose length is radius; edges are
+ *        weighted by their length, so euclidean distances between the
+ *        points are admissible heuristics (see astar)
+ * @param rng Random number generator
+ * @return Graph with about pi radius^2 num_nodes edges per vertex
+ */
+template<typename RandomNumberGenerator = std::mt19937, typename W = Weight>
+BasicGraph<W> generateGeometricGraph(
+    std::size_t num_nodes, double radius, W max_weight,
+    RandomNumberGenerator rng
+      = RandomNumberGenerator{ RandomNumberGenerator::default_seed }) {
+  assert(radius > 0);
+
+  std::uniform_real_distribution<double> coordinate_generator(0, 1);
+  std::vector<std::pair<double, double>> points(num_nodes);
+  for (auto& point : points) {
+    point.first = coordinate_generator(rng);
+    point.second = coordinate_generator(rng);
+  }
+
+  // Points are bucketed in square cells of side at least radius, so only
+  // points of neighbor cells need to be compared; there are at most about
+  // num_nodes cells, as smaller ones would be mostly empty
+  auto side = std::max<std::size_t>(
+    1, static_cast<std::size_t>(
+         std::min(1 / radius, std::sqrt(static_cast<double>(num_nodes)))));
+  auto cell_of = [side](double coordinate) {
+    return std::min(side - 1, static_cast<std::size_t>(coordinate * side));
+  };
+
+  std::vector<std::vector<Key>> cells(side * side);
+  for (Key u = 0; u < num_nodes; u++)
+    cells[cell_of(points[u].second) * side + cell_of(points[u].first)]
+      .push_back(u);
+
+  BasicGraph<W> graph(num_nodes);
+  for (Key u = 0; u < num_nodes; u++) {
+    auto x = cell_of(points[u].first), y = cell_of(points[u].second);
+    for (auto i = y > 0 ? y - 1 : y; i <= y + 1 && i < side; i++) {
+      for (auto j = x > 0 ? x - 1 : x; j <= x + 1 && j < side; j++) {
+        for (auto v : cells[i * side + j]) {
+          if (v == u) continue;
+          auto length = std::hypot(points[u].first - points[v].first,
+                                   points[u].second - points[v].second);
+          if (length > radius) continue;
+          graph[u].push_back(
+            BasicEdge<W>{v, castWeight<W>(max_weight * length / radius)});
+        }
+      }
+    }
+  }
+
+  return graph;
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_GENERATORS_
@@ -22,33 +22,80 @@
 // Standard headers
 #include <vector>
 #include <random>
+#include <utility>
 #include <iostream>
+#include <type_traits>
 
 // Internal headers
 #include "graph/Edge.hpp"
 
 namespace graph {
 
-using Graph = std::vector<std::vector<Edge>>;
+template<typename W>
+using BasicGraph = std::vector<std::vector<BasicEdge<W>>>;
 
-template<typename RandomNumberGenerator>
-graph::Graph generateRandomGraph(
-    size_t num_nodes, size_t num_edges, Weight max_weight,
+using Graph = BasicGraph<Weight>;
+
+/**
+ * Type of the weights of the edges of a graph
+ */
+template<typename GraphType>
+using WeightOf = typename std::decay<
+  decltype(std::declval<const GraphType&>()[0][0].weight)>::type;
+
+/**
+ * Distribution of random weights of type W
+ */
+template<typename W>
+using WeightDistribution = typename std::conditional<
+  std::is_integral<W>::value,
+  std::uniform_int_distribution<W>,
+  std::uniform_real_distribution<W>>::type;
+
+/**
+ * Build the reverse of a graph, where every edge u->v becomes v->u
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph to be reversed
+ * @return Reverse graph stored as adjacency lists
+ */
+template<typename GraphType>
+BasicGraph<WeightOf<GraphType>> reverseGraph(const GraphType& G) {
+  using W = WeightOf<GraphType>;
+
+  std::vector<std::size_t> degree(G.size(), 0);
+  for (Key u = 0; u < G.size(); u++)
+    for (const auto& edge : G[u])
+      degree[edge.key]++;
+
+  BasicGraph<W> reverse(G.size());
+  for (Key v = 0; v < G.size(); v++)
+    reverse[v].reserve(degree[v]);
+
+  for (Key u = 0; u < G.size(); u++)
+    for (const auto& edge : G[u])
+      reverse[edge.key].push_back(BasicEdge<W>{u, edge.weight});
+
+  return reverse;
+}
+
+template<typename RandomNumberGenerator, typename W = Weight>
+graph::BasicGraph<W> generateRandomGraph(
+    size_t num_nodes, size_t num_edges, W max_weight,
     RandomNumberGenerator rng
       = RandomNumberGenerator{ RandomNumberGenerator::default_seed }) {
   assert((num_nodes == 0 && num_edges == 0)
          || (num_edges <= num_nodes*(num_nodes-1)/2.0));
 
   std::uniform_int_distribution<Key> node_generator(0, num_nodes-1);
-  std::uniform_real_distribution<Weight> weight_generator(0, max_weight);
+  WeightDistribution<W> weight_generator(0, max_weight);
 
-  Graph graph(num_nodes);
+  BasicGraph<W> graph(num_nodes);
 
   for (unsigned int i = 0; i < num_edges; i++) {
     auto src = node_generator(rng);
     auto dst = node_generator(rng);
     auto weight = weight_generator(rng);
-    graph[src].push_back(Edge{dst, weight});
+    graph[src].push_back(BasicEdge<W>{dst, weight});
   }
 
   return graph;
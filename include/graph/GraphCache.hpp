@@ -0,0 +1,234 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_GRAPH_CACHE_
+#define GRAPH_GRAPH_CACHE_
+
+// Standard headers
+#include <list>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <limits>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+
+// System headers
+#include <unistd.h>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+#include "graph/MappedGraph.hpp"
+
+namespace graph {
+
+/**
+ * @class BasicGraphCache
+ * @brief Random graphs (see generateRandomGraph) generated once for
+ *        each combination of parameters and seed, kept in memory while
+ *        they fit in a budget and, optionally, saved in binary format
+ *        (see saveGraph) to be reused by later processes
+ */
+template<typename W>
+class BasicGraphCache {
+ public:
+  // Static variables
+
+  // Saved in the names of the files, to be increased whenever
+  // generateRandomGraph changes the graphs it generates
+  static constexpr unsigned int generator_version = 2;
+
+  // Constructors
+
+  /**
+   * @param directory Where graphs are saved (empty to keep them only in
+   *        memory)
+   * @param max_bytes Memory used by graphs kept in memory; the least
+   *        recently used ones are discarded to make room for new ones,
+   *        and graphs bigger than it are never kept
+   */
+  explicit BasicGraphCache(
+      std::string directory = "",
+      std::size_t max_bytes = std::numeric_limits<std::size_t>::max())
+      : directory(std::move(directory)), max_bytes(max_bytes) {
+  }
+
+  BasicGraphCache(const BasicGraphCache&) = delete;
+
+  // Overloaded operators
+  BasicGraphCache& operator=(const BasicGraphCache&) = delete;
+
+  // Concrete methods
+
+  /**
+   * Get the graph of generateRandomGraph with the given parameters,
+   * loading or generating it only if it is not in memory yet
+   * @param num_nodes Number of vertices
+   * @param num_edges Number of edges
+   * @param max_weight Maximum weight of the edges
+   * @param seed Seed of std::mt19937 used to generate the graph
+   * @return Graph, shared with the cache and kept alive by the returned
+   *         pointer even if the cache discards it later
+   */
+  std::shared_ptr<const BasicGraph<W>> random_graph(std::size_t num_nodes,
+                                                    std::size_t num_edges,
+                                                    W max_weight,
+                                                    std::uint32_t seed) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto key = std::make_tuple(num_nodes, num_edges, max_weight, seed);
+    for (auto it = graphs.begin(); it != graphs.end(); ++it) {
+      if (it->key != key) continue;
+      graphs.splice(graphs.begin(), graphs, it);
+      return graphs.front().graph;
+    }
+
+    auto graph = std::make_shared<const BasicGraph<W>>(directory.empty()
+      ? generateRandomGraph(num_nodes, num_edges, max_weight,
+                            std::mt19937{seed})
+      : load_or_generate(num_nodes, num_edges, max_weight, seed));
+
+    auto bytes = allocated_bytes(*graph);
+    if (bytes > max_bytes) return graph;
+
+    while (!graphs.empty() && used_bytes + bytes > max_bytes) {
+      used_bytes -= graphs.back().bytes;
+      graphs.pop_back();
+    }
+
+    used_bytes += bytes;
+    graphs.push_front(entry{key, std::move(graph), bytes});
+    return graphs.front().graph;
+  }
+
+  /**
+   * Discard all graphs kept in memory
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    graphs.clear();
+    used_bytes = 0;
+  }
+
+  /**
+   * @return Number of graphs kept in memory
+   */
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return graphs.size();
+  }
+
+ private:
+  // Aliases
+  using key_type = std::tuple<std::size_t, std::size_t, W, std::uint32_t>;
+
+  // Inner structs
+  struct entry {
+    key_type key;
+    std::shared_ptr<const BasicGraph<W>> graph;
+    std::size_t bytes;
+  };
+
+  // Instance variables
+  std::string directory;
+  std::size_t max_bytes;
+  std::size_t used_bytes = 0;
+  std::list<entry> graphs;  // From the most to the least recently used
+  mutable std::mutex mutex;
+
+  // Concrete methods
+
+  /**
+   * @return Memory allocated by the adjacency lists of graph
+   */
+  static std::size_t allocated_bytes(const BasicGraph<W>& graph) {
+    auto bytes = graph.capacity() * sizeof(typename BasicGraph<W>::value_type);
+    for (const auto& edges : graph)
+      bytes += edges.capacity() * sizeof(BasicEdge<W>);
+    return bytes;
+  }
+
+  /**
+   * Load graph saved in the directory, or generate and save it
+   * @return Random graph with the given parameters
+   */
+  BasicGraph<W> load_or_generate(std::size_t num_nodes,
+                                 std::size_t num_edges,
+                                 W max_weight, std::uint32_t seed) const {
+    std::ostringstream oss;
+    oss << directory << "/random_v" << generator_version
+        << "_" << num_nodes << "_" << num_edges << "_"
+        << std::setprecision(std::numeric_limits<W>::max_digits10)
+        << max_weight << "_" << seed << ".graph";
+    auto path = oss.str();
+
+    if (std::ifstream(path)) {
+      BasicMappedGraph<W> mapped(path);
+      BasicGraph<W> graph(mapped.size());
+      for (Key u = 0; u < mapped.size(); u++) {
+        graph[u].reserve(mapped[u].size());
+        for (const auto& edge : mapped[u])
+          graph[u].push_back(BasicEdge<W>{edge.key, edge.weight});
+      }
+      return graph;
+    }
+
+    auto graph = generateRandomGraph(num_nodes, num_edges, max_weight,
+                                     std::mt19937{seed});
+
+    // Renamed only when complete, so other processes never see a
+    // partially written file nor write to the same one
+    auto partial_path = path + "." + std::to_string(::getpid())
+                        + ".partial";
+    saveGraph(graph, partial_path);
+    if (std::rename(partial_path.c_str(), path.c_str()) != 0)
+      throw std::runtime_error("Cannot rename " + partial_path);
+
+    return graph;
+  }
+};
+
+using GraphCache = BasicGraphCache<Weight>;
+
+/**
+ * Cache shared by all callers in the process, keeping up to 1GB of
+ * graphs in memory and saving them in the directory given by the
+ * environment variable GRAPH_CACHE_DIR, if set
+ * @return Shared cache of random graphs of type Graph
+ */
+inline GraphCache& sharedGraphCache() {
+  static GraphCache cache(std::getenv("GRAPH_CACHE_DIR")
+                          ? std::getenv("GRAPH_CACHE_DIR") : "",
+                          std::size_t(1) << 30);
+  return cache;
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_GRAPH_CACHE_
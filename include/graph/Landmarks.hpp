@@ -0,0 +1,206 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_LANDMARKS_
+#define GRAPH_LANDMARKS_
+
+// Standard headers
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+#include "graph/dijkstra.hpp"
+
+namespace graph {
+
+/**
+ * @class BasicLandmarks
+ * @brief Distances from and to a few landmark nodes, used to bound the
+ *        distance between any two nodes by the triangle inequality (ALT)
+ */
+template<typename W>
+class BasicLandmarks {
+ public:
+  // Inner classes
+
+  /**
+   * @class heuristic_type
+   * @brief Lower bound of the distance to a fixed destination, to be
+   *        used as the heuristic of astar
+   */
+  class heuristic_type {
+   public:
+    // Constructors
+    heuristic_type(const BasicLandmarks& landmarks, Key destination)
+        : landmarks(&landmarks), destination(destination) {
+    }
+
+    // Overloaded operators
+    W operator()(const Key& u) const {
+      return landmarks->lower_bound(u, destination);
+    }
+
+   private:
+    // Instance variables
+    const BasicLandmarks* landmarks;
+    Key destination;
+  };
+
+  // Constructors
+  BasicLandmarks() = default;
+
+  /**
+   * @param nodes Landmark nodes
+   * @param from Distance from each landmark to each node u, stored in
+   *             position u * nodes.size() + i for the i-th landmark
+   * @param to Distance to each landmark from each node u, stored as
+   *           the distances from the landmarks
+   */
+  BasicLandmarks(std::vector<Key> nodes,
+                 std::vector<W> from, std::vector<W> to)
+      : landmarks(std::move(nodes)),
+        from(std::move(from)), to(std::move(to)) {
+    assert(this->from.size() == this->to.size());
+    assert(landmarks.empty() || this->from.size() % landmarks.size() == 0);
+  }
+
+  // Concrete methods
+
+  /**
+   * Bound the distance between two nodes in time O(k), where k is the
+   * number of landmarks
+   * @param u Node where the path starts
+   * @param v Node where the path ends
+   * @return Lower bound of the distance from u to v
+   */
+  W lower_bound(const Key& u, const Key& v) const {
+    W bound = 0;
+    auto k = landmarks.size();
+    for (std::size_t i = 0; i < k; i++) {
+      // d(L,v) <= d(L,u) + d(u,v) and d(u,L) <= d(u,v) + d(v,L)
+      improve(bound, from[v*k + i], from[u*k + i]);
+      improve(bound, to[u*k + i], to[v*k + i]);
+    }
+    return bound;
+  }
+
+  /**
+   * @param destination Node where the paths will end
+   * @return Heuristic bounding the distance from any node to destination
+   */
+  heuristic_type heuristic(const Key& destination) const {
+    return heuristic_type(*this, destination);
+  }
+
+  /**
+   * @return Landmark nodes
+   */
+  const std::vector<Key>& nodes() const {
+    return landmarks;
+  }
+
+  /**
+   * @return Number of landmarks
+   */
+  std::size_t size() const {
+    return landmarks.size();
+  }
+
+ private:
+  // Instance variables
+  std::vector<Key> landmarks;
+  std::vector<W> from;
+  std::vector<W> to;
+
+  // Class methods
+
+  /**
+   * Raise bound to longer - shorter, if both distances are known
+   */
+  static void improve(W& bound, const W& longer, const W& shorter) {
+    if (longer == infinity<W>() || shorter == infinity<W>()) return;
+    if (longer > shorter) bound = std::max<W>(bound, longer - shorter);
+  }
+};
+
+using Landmarks = BasicLandmarks<Weight>;
+
+/**
+ * Select landmarks far from each other and precompute their distances
+ * from and to all nodes with dijkstra, in time O(k (n + m) lg n)
+ * @tparam PriorityQueue Heap used by dijkstra
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param num_landmarks Number of landmarks to be selected
+ * @return Landmarks of the graph
+ */
+template<template<typename...> class PriorityQueue,
+         typename GraphType>
+BasicLandmarks<WeightOf<GraphType>> buildLandmarks(
+    const GraphType& G, std::size_t num_landmarks) {
+  using W = WeightOf<GraphType>;
+
+  auto n = G.size();
+  auto k = std::min(num_landmarks, n);
+  auto R = reverseGraph(G);
+
+  auto distances = [](const auto& graph, Key source) {
+    return shortestPathTree<PriorityQueue>(graph, source).distance;
+  };
+
+  std::vector<Key> nodes;
+  std::vector<W> from(n * k), to(n * k);
+
+  // Closeness of each node to the landmarks selected so far, starting
+  // from the distances of an arbitrary node
+  auto closeness = n > 0 ? distances(G, 0) : std::vector<W>();
+
+  for (std::size_t i = 0; i < k; i++) {
+    // Next landmark is the reachable node farthest from the others
+    Key landmark = 0;
+    for (Key u = 0; u < n; u++) {
+      if (closeness[u] == infinity<W>()) continue;
+      if (closeness[landmark] == infinity<W>()
+          || closeness[u] > closeness[landmark])
+        landmark = u;
+    }
+    nodes.push_back(landmark);
+
+    auto from_landmark = distances(G, landmark);
+    auto to_landmark = distances(R, landmark);
+    for (Key u = 0; u < n; u++) {
+      from[u*k + i] = from_landmark[u];
+      to[u*k + i] = to_landmark[u];
+      closeness[u] = i == 0 ? from_landmark[u]
+                            : std::min(closeness[u], from_landmark[u]);
+    }
+  }
+
+  return BasicLandmarks<W>(std::move(nodes), std::move(from),
+                           std::move(to));
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_LANDMARKS_
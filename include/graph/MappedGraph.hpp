@@ -0,0 +1,423 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_MAPPED_GRAPH_
+#define GRAPH_MAPPED_GRAPH_
+
+// Standard headers
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+
+// System headers
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/TextGraph.hpp"
+
+namespace graph {
+
+/**
+ * @class GraphFileHeader
+ * @brief Header of the binary graph format, followed by the sections
+ *        of a CSR graph: num_nodes+1 64 bits offsets, num_edges 32 bits
+ *        targets and num_edges weights, each section aligned to 8 bytes.
+ *        All values are stored little-endian
+ */
+struct GraphFileHeader {
+  // Static variables
+  static constexpr std::uint32_t current_version = 1;
+
+  // Instance variables
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t weight_type;
+  std::uint64_t num_nodes;
+  std::uint64_t num_edges;
+  std::uint64_t targets_position;
+  std::uint64_t weights_position;
+
+  // Class methods
+
+  /**
+   * @return First 8 bytes of every file in the binary format (a function
+   *         rather than a static array, so the header can be included by
+   *         many translation units)
+   */
+  static const char* magic_value() {
+    return "HEAPSCSR";
+  }
+};
+
+/**
+ * @class GraphFileWeight
+ * @brief Code identifying the type of the weights in the binary format
+ */
+template<typename W> struct GraphFileWeight;
+
+template<> struct GraphFileWeight<double> {
+  static constexpr std::uint32_t code = 1;
+};
+
+template<> struct GraphFileWeight<float> {
+  static constexpr std::uint32_t code = 2;
+};
+
+template<> struct GraphFileWeight<std::int32_t> {
+  static constexpr std::uint32_t code = 3;
+};
+
+template<> struct GraphFileWeight<std::uint32_t> {
+  static constexpr std::uint32_t code = 4;
+};
+
+template<> struct GraphFileWeight<std::int64_t> {
+  static constexpr std::uint32_t code = 5;
+};
+
+template<> struct GraphFileWeight<std::uint64_t> {
+  static constexpr std::uint32_t code = 6;
+};
+
+namespace detail {
+
+/**
+ * @return True if the binary format can be used without byte swapping
+ */
+inline bool isLittleEndian() {
+  std::uint32_t value = 1;
+  unsigned char first;
+  std::memcpy(&first, &value, 1);
+  return first == 1;
+}
+
+/**
+ * @param position Position in bytes
+ * @return Smallest position aligned to 8 bytes not smaller than position
+ */
+inline std::uint64_t alignPosition(std::uint64_t position) {
+  return (position + 7) & ~std::uint64_t(7);
+}
+
+/**
+ * Write values in chunks, to avoid one call to the stream per value
+ * @param os Output stream
+ * @param buffer Values to be written, cleared afterwards
+ */
+template<typename T>
+void flushBuffer(std::ostream& os, std::vector<T>& buffer) {
+  os.write(reinterpret_cast<const char*>(buffer.data()),
+           buffer.size() * sizeof(T));
+  buffer.clear();
+}
+
+}  // namespace detail
+
+/**
+ * Save graph in the binary format, which can be loaded by MappedGraph
+ * @param G Graph, CsrGraph or MappedGraph
+ * @param path Path of the file to be written
+ */
+template<typename GraphType>
+void saveGraph(const GraphType& G, const std::string& path) {
+  using W = WeightOf<GraphType>;
+
+  static_assert(sizeof(Key) == sizeof(std::uint32_t),
+                "Binary graph format requires 32 bits keys");
+
+  if (!detail::isLittleEndian())
+    throw std::runtime_error("Binary graph format requires little-endian");
+
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  if (!os) throw std::runtime_error("Cannot open " + path);
+
+  std::vector<std::uint64_t> offsets(1, 0);
+  offsets.reserve(G.size() + 1);
+  for (Key u = 0; u < G.size(); u++)
+    offsets.push_back(offsets.back() + G[u].size());
+
+  GraphFileHeader header;
+  std::memcpy(header.magic, GraphFileHeader::magic_value(),
+              sizeof(header.magic));
+  header.version = GraphFileHeader::current_version;
+  header.weight_type = GraphFileWeight<W>::code;
+  header.num_nodes = G.size();
+  header.num_edges = offsets.back();
+  header.targets_position = detail::alignPosition(
+    sizeof(GraphFileHeader) + offsets.size() * sizeof(std::uint64_t));
+  header.weights_position = detail::alignPosition(
+    header.targets_position + header.num_edges * sizeof(Key));
+
+  const char padding[8] = {};
+
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  detail::flushBuffer(os, offsets);
+  os.write(padding, header.targets_position - os.tellp());
+
+  const std::size_t chunk_size = 64 * 1024;
+
+  std::vector<Key> targets;
+  targets.reserve(chunk_size);
+  for (Key u = 0; u < G.size(); u++) {
+    for (const auto& edge : G[u]) {
+      targets.push_back(edge.key);
+      if (targets.size() == chunk_size) detail::flushBuffer(os, targets);
+    }
+  }
+  detail::flushBuffer(os, targets);
+  os.write(padding, header.weights_position - os.tellp());
+
+  std::vector<W> weights;
+  weights.reserve(chunk_size);
+  for (Key u = 0; u < G.size(); u++) {
+    for (const auto& edge : G[u]) {
+      weights.push_back(edge.weight);
+      if (weights.size() == chunk_size) detail::flushBuffer(os, weights);
+    }
+  }
+  detail::flushBuffer(os, weights);
+
+  if (!os) throw std::runtime_error("Cannot write " + path);
+}
+
+/**
+ * @class BasicMappedGraph
+ * @brief CSR graph read directly from a memory-mapped file written by
+ *        saveGraph, without copying its contents
+ */
+template<typename W>
+class BasicMappedGraph {
+ public:
+  // Constructors
+  BasicMappedGraph() = default;
+
+  /**
+   * Map a file in the binary graph format in time O(n + m), spent
+   * checking its offsets and targets
+   * @param path Path of the file to be mapped
+   */
+  explicit BasicMappedGraph(const std::string& path) {
+    if (!detail::isLittleEndian())
+      throw std::runtime_error("Binary graph format requires little-endian");
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open " + path);
+
+    struct stat status;
+    if (::fstat(fd, &status) < 0) {
+      ::close(fd);
+      throw std::runtime_error("Cannot read size of " + path);
+    }
+
+    length = static_cast<std::size_t>(status.st_size);
+    if (length < sizeof(GraphFileHeader)) {
+      ::close(fd);
+      throw std::runtime_error(path + " is not a graph file");
+    }
+
+    address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      address = nullptr;
+      throw std::runtime_error("Cannot map " + path);
+    }
+
+    try {
+      validate(path);
+    } catch (...) {
+      unmap();
+      throw;
+    }
+  }
+
+  BasicMappedGraph(const BasicMappedGraph&) = delete;
+
+  BasicMappedGraph(BasicMappedGraph&& other) {
+    swap(other);
+  }
+
+  // Destructor
+  ~BasicMappedGraph() {
+    unmap();
+  }
+
+  // Overloaded operators
+  BasicMappedGraph& operator=(BasicMappedGraph other) {
+    swap(other);
+    return *this;
+  }
+
+  /**
+   * @param u Vertex whose edges will be returned
+   * @return Range with the edges leaving u
+   */
+  BasicAdjacency<W> operator[](Key u) const {
+    return BasicAdjacency<W>(targets + offsets[u],
+                             weights + offsets[u],
+                             offsets[u+1] - offsets[u]);
+  }
+
+  // Concrete methods
+
+  /**
+   * @return Number of vertices of the graph
+   */
+  std::size_t size() const {
+    return header ? header->num_nodes : 0;
+  }
+
+  /**
+   * @return Number of edges of the graph
+   */
+  std::size_t num_edges() const {
+    return header ? header->num_edges : 0;
+  }
+
+  /**
+   * Exchange mapping with other graph in time O(1)
+   * @param other Graph to exchange mappings with
+   */
+  void swap(BasicMappedGraph& other) {
+    std::swap(address, other.address);
+    std::swap(length, other.length);
+    std::swap(header, other.header);
+    std::swap(offsets, other.offsets);
+    std::swap(targets, other.targets);
+    std::swap(weights, other.weights);
+  }
+
+ private:
+  // Instance variables
+  void* address = nullptr;
+  std::size_t length = 0;
+
+  const GraphFileHeader* header = nullptr;
+  const std::uint64_t* offsets = nullptr;
+  const Key* targets = nullptr;
+  const W* weights = nullptr;
+
+  // Concrete methods
+
+  /**
+   * Check header and sections of the mapped file and locate them
+   * @param path Path of the file, for error messages
+   */
+  void validate(const std::string& path) {
+    auto bytes = static_cast<const char*>(address);
+    header = reinterpret_cast<const GraphFileHeader*>(bytes);
+
+    if (std::memcmp(header->magic, GraphFileHeader::magic_value(),
+                    sizeof(header->magic)) != 0)
+      throw std::runtime_error(path + " is not a graph file");
+
+    if (header->version != GraphFileHeader::current_version) {
+      std::ostringstream oss;
+      oss << "Unsupported version " << header->version << " of " << path;
+      throw std::runtime_error(oss.str());
+    }
+
+    if (header->weight_type != GraphFileWeight<W>::code)
+      throw std::runtime_error("Unexpected weight type in " + path);
+
+    if (header->num_nodes >= length || header->num_edges >= length)
+      throw std::runtime_error(path + " is truncated");
+
+    // Positions are checked before sizes are added to them, so corrupt
+    // headers cannot make the ends of the sections wrap around
+    auto fits = [this](std::uint64_t position, std::uint64_t size) {
+      return position <= length && size <= length - position;
+    };
+
+    auto offsets_end = sizeof(GraphFileHeader)
+                     + (header->num_nodes + 1) * sizeof(std::uint64_t);
+    auto targets_size = header->num_edges * sizeof(Key);
+    auto weights_size = header->num_edges * sizeof(W);
+
+    if (offsets_end > length
+        || header->targets_position < offsets_end
+        || !fits(header->targets_position, targets_size)
+        || header->weights_position
+             < header->targets_position + targets_size
+        || !fits(header->weights_position, weights_size))
+      throw std::runtime_error(path + " is truncated");
+
+    if (header->targets_position % alignof(Key) != 0
+        || header->weights_position % alignof(W) != 0)
+      throw std::runtime_error(path + " has misaligned sections");
+
+    offsets = reinterpret_cast<const std::uint64_t*>(
+      bytes + sizeof(GraphFileHeader));
+    targets = reinterpret_cast<const Key*>(
+      bytes + header->targets_position);
+    weights = reinterpret_cast<const W*>(
+      bytes + header->weights_position);
+
+    // Edges are accessed without bounds checks, so corrupt sections
+    // must be rejected here
+    if (offsets[0] != 0 || offsets[header->num_nodes] != header->num_edges)
+      throw std::runtime_error(path + " has inconsistent offsets");
+
+    for (std::size_t u = 0; u < header->num_nodes; u++)
+      if (offsets[u] > offsets[u+1])
+        throw std::runtime_error(path + " has inconsistent offsets");
+
+    for (std::size_t i = 0; i < header->num_edges; i++)
+      if (targets[i] >= header->num_nodes)
+        throw std::runtime_error(path + " has edges to invalid vertices");
+  }
+
+  /**
+   * Release mapping, if any
+   */
+  void unmap() {
+    if (address) ::munmap(address, length);
+    address = nullptr;
+    length = 0;
+    header = nullptr;
+  }
+};
+
+using MappedGraph = BasicMappedGraph<Weight>;
+
+/**
+ * Convert graph in text format (see parseGraph) to the binary format
+ * @tparam W Type of the weights
+ * @param text_path Path of the file in text format
+ * @param binary_path Path of the file to be written in binary format
+ */
+template<typename W = Weight>
+void convertGraph(const std::string& text_path,
+                  const std::string& binary_path) {
+  saveGraph(loadCsrGraph<W>(text_path), binary_path);
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_MAPPED_GRAPH_
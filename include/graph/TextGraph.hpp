@@ -0,0 +1,511 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_TEXT_GRAPH_
+#define GRAPH_TEXT_GRAPH_
+
+// Standard headers
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <exception>
+#include <type_traits>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+#include "graph/CsrGraph.hpp"
+
+namespace graph {
+
+namespace detail {
+
+/**
+ * @class FastFloat
+ * @brief Limits where a decimal number can be converted exactly with a
+ *        single floating point multiplication or division
+ */
+template<typename W> struct FastFloat;
+
+template<> struct FastFloat<double> {
+  static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 53;
+  static constexpr int max_exponent = 22;
+
+  static double power_of_ten(int exponent) {
+    static constexpr double powers[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return powers[exponent];
+  }
+
+  static double fallback(const char* number) {
+    return std::strtod(number, nullptr);
+  }
+};
+
+template<> struct FastFloat<float> {
+  static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 24;
+  static constexpr int max_exponent = 10;
+
+  static float power_of_ten(int exponent) {
+    static constexpr float powers[] = {
+      1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+    };
+    return powers[exponent];
+  }
+
+  static float fallback(const char* number) {
+    return std::strtof(number, nullptr);
+  }
+};
+
+inline bool isDigit(char c) {
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+inline bool isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline void skipBlanks(const char*& p, const char* end) {
+  while (p != end && isBlank(*p)) ++p;
+}
+
+/**
+ * Parse an unsigned number
+ * @param p Position where the number starts, moved to where it ends
+ * @param end End of the buffer
+ * @param limit Maximum value of the number
+ * @param value Parsed number
+ * @return True if a number not bigger than limit was parsed
+ */
+template<typename U>
+bool parseUnsigned(const char*& p, const char* end, U limit, U& value) {
+  if (p == end || !isDigit(*p)) return false;
+  value = 0;
+  for (; p != end && isDigit(*p); ++p) {
+    auto digit = static_cast<U>(*p - '0');
+    if (value > (limit - digit) / 10) return false;
+    value = static_cast<U>(10 * value + digit);
+  }
+  return true;
+}
+
+/**
+ * Parse a node key
+ * @param p Position where the key starts, moved to where it ends
+ * @param end End of the buffer
+ * @param key Parsed key
+ * @return True if a key that fits in Key was parsed
+ */
+inline bool parseKey(const char*& p, const char* end, Key& key) {
+  return parseUnsigned(p, end, std::numeric_limits<Key>::max(), key);
+}
+
+/**
+ * Parse an integral weight
+ * @param p Position where the weight starts, moved to where it ends
+ * @param end End of the buffer
+ * @param weight Parsed weight
+ * @return True if a weight that fits in W was parsed
+ */
+template<typename W>
+typename std::enable_if<std::is_integral<W>::value, bool>::type
+parseWeight(const char*& p, const char* end, W& weight) {
+  using U = typename std::make_unsigned<W>::type;
+
+  bool negative = false;
+  if (p != end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+  // Magnitude of the minimum of a signed W is one more than its maximum
+  U limit = std::numeric_limits<W>::max();
+  if (negative && std::is_signed<W>::value) limit++;
+
+  U magnitude;
+  if (!parseUnsigned(p, end, limit, magnitude)) return false;
+  weight = static_cast<W>(negative ? U(0) - magnitude : magnitude);
+  return true;
+}
+
+/**
+ * Parse a floating point weight, converting it exactly when its
+ * mantissa and exponent are small (Clinger's fast path) and falling
+ * back to the C library otherwise
+ * @param p Position where the weight starts, moved to where it ends
+ * @param end End of the buffer
+ * @param weight Parsed weight
+ * @return True if a weight was parsed
+ */
+template<typename W>
+typename std::enable_if<std::is_floating_point<W>::value, bool>::type
+parseWeight(const char*& p, const char* end, W& weight) {
+  auto start = p;
+
+  bool negative = false;
+  if (p != end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+  std::uint64_t mantissa = 0;
+  int significant_digits = 0, num_digits = 0, exponent = 0;
+
+  for (; p != end && isDigit(*p); ++p, ++num_digits) {
+    if (mantissa == 0 && *p == '0') continue;
+    if (significant_digits++ < 19) mantissa = 10 * mantissa + (*p - '0');
+    else exponent++;
+  }
+
+  if (p != end && *p == '.') {
+    for (++p; p != end && isDigit(*p); ++p, ++num_digits) {
+      if (mantissa == 0 && *p == '0') { exponent--; continue; }
+      if (significant_digits++ < 19) {
+        mantissa = 10 * mantissa + (*p - '0');
+        exponent--;
+      }
+    }
+  }
+
+  if (num_digits == 0) return false;
+
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    auto q = p + 1;
+    bool negative_exponent = false;
+    if (q != end && (*q == '-' || *q == '+'))
+      negative_exponent = (*q++ == '-');
+
+    if (q != end && isDigit(*q)) {
+      int value = 0;
+      for (; q != end && isDigit(*q); ++q)
+        if (value < 100000) value = 10 * value + (*q - '0');
+      exponent += negative_exponent ? -value : value;
+      p = q;
+    }
+  }
+
+  using Limits = FastFloat<W>;
+  if (significant_digits <= 19
+      && mantissa <= Limits::max_mantissa
+      && exponent >= -Limits::max_exponent
+      && exponent <= Limits::max_exponent) {
+    weight = static_cast<W>(mantissa);
+    if (exponent < 0) weight /= Limits::power_of_ten(-exponent);
+    else weight *= Limits::power_of_ten(exponent);
+    if (negative) weight = -weight;
+    return true;
+  }
+
+  char buffer[64];
+  auto length = static_cast<std::size_t>(p - start);
+  if (length < sizeof(buffer)) {
+    std::copy(start, p, buffer);
+    buffer[length] = '\0';
+    weight = Limits::fallback(buffer);
+  } else {
+    weight = Limits::fallback(std::string(start, p).c_str());
+  }
+  return true;
+}
+
+/**
+ * @class ParsedChunk
+ * @brief Edges parsed from a range of lines of a graph in text format
+ */
+template<typename W>
+struct ParsedChunk {
+  std::vector<std::size_t> degrees;
+  std::vector<Key> targets;
+  std::vector<W> weights;
+  std::size_t error_line = 0;  // Line with a malformed edge, if not 0
+};
+
+/**
+ * Parse lines of a graph in text format
+ * @param p Start of the first line
+ * @param end End of the last line
+ * @param chunk Chunk where the edges will be stored
+ */
+template<typename W>
+void parseChunk(const char* p, const char* end, ParsedChunk<W>& chunk) {
+  while (p != end) {
+    std::size_t degree = 0;
+
+    while (true) {
+      skipBlanks(p, end);
+      if (p == end || *p == '\n') break;
+
+      Key key;
+      W weight;
+
+      bool parsed = *p++ == '(';
+      if (parsed) { skipBlanks(p, end); parsed = parseKey(p, end, key); }
+      if (parsed) { skipBlanks(p, end); parsed = p != end && *p++ == ','; }
+      if (parsed) { skipBlanks(p, end); parsed = parseWeight(p, end, weight); }
+      if (parsed) { skipBlanks(p, end); parsed = p != end && *p++ == ')'; }
+
+      if (!parsed) {
+        chunk.error_line = chunk.degrees.size() + 1;
+        return;
+      }
+
+      chunk.targets.push_back(key);
+      chunk.weights.push_back(weight);
+      degree++;
+    }
+
+    chunk.degrees.push_back(degree);
+    if (p != end) ++p;  // Skip line break
+  }
+}
+
+/**
+ * Parse a graph in text format, splitting it in chunks of whole lines
+ * parsed by different threads
+ * @param first Start of the buffer with the graph
+ * @param last End of the buffer with the graph
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Edges parsed from each chunk, in order
+ */
+template<typename W>
+std::vector<ParsedChunk<W>> parseChunks(const char* first, const char* last,
+                                        unsigned int num_threads) {
+  // Chunks smaller than this are not worth a thread
+  const std::size_t min_chunk_size = 1 << 20;
+
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  auto size = static_cast<std::size_t>(last - first);
+  auto num_chunks = std::min<std::size_t>(
+    std::max(num_threads, 1u), size / min_chunk_size + 1);
+
+  std::vector<const char*> bounds(1, first);
+  for (std::size_t i = 1; i < num_chunks; i++) {
+    auto bound = std::max(bounds.back(), first + i * size / num_chunks);
+    while (bound != last && *bound != '\n') ++bound;
+    if (bound != last) ++bound;
+    bounds.push_back(bound);
+  }
+  bounds.push_back(last);
+
+  std::vector<ParsedChunk<W>> chunks(num_chunks);
+  std::vector<std::exception_ptr> errors(num_chunks);
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 1; i < num_chunks; i++) {
+    threads.emplace_back([&bounds, &chunks, &errors, i] {
+      try {
+        parseChunk(bounds[i], bounds[i+1], chunks[i]);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  parseChunk(bounds[0], bounds[1], chunks[0]);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  std::size_t num_lines = 0;
+  for (std::size_t i = 0; i < num_chunks; i++) {
+    if (errors[i]) std::rethrow_exception(errors[i]);
+    if (chunks[i].error_line != 0) {
+      std::ostringstream oss;
+      oss << "Malformed edge in line " << num_lines + chunks[i].error_line;
+      throw std::invalid_argument(oss.str());
+    }
+    num_lines += chunks[i].degrees.size();
+  }
+
+  return chunks;
+}
+
+/**
+ * Read whole file in a single buffer
+ * @param path Path of the file
+ * @return Contents of the file
+ */
+inline std::string readFile(const std::string& path) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is) throw std::runtime_error("Cannot open " + path);
+
+  is.seekg(0, std::ios::end);
+  std::string buffer(static_cast<std::size_t>(is.tellg()), '\0');
+  is.seekg(0, std::ios::beg);
+  is.read(&buffer[0], buffer.size());
+
+  if (!is) throw std::runtime_error("Cannot read " + path);
+  return buffer;
+}
+
+}  // namespace detail
+
+/**
+ * Parse graph in text format, where the n-th line has the edges leaving
+ * node n as space separated (key,weight) pairs
+ * @tparam W Type of the weights
+ * @param first Start of the buffer with the graph
+ * @param last End of the buffer with the graph
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Graph stored as adjacency lists
+ */
+template<typename W = Weight>
+BasicGraph<W> parseGraph(const char* first, const char* last,
+                         unsigned int num_threads = 0) {
+  auto chunks = detail::parseChunks<W>(first, last, num_threads);
+
+  BasicGraph<W> graph;
+  for (const auto& chunk : chunks) {
+    std::size_t edge = 0;
+    for (auto degree : chunk.degrees) {
+      graph.emplace_back();
+      graph.back().reserve(degree);
+      for (auto end = edge + degree; edge < end; edge++)
+        graph.back().push_back(
+          BasicEdge<W>{chunk.targets[edge], chunk.weights[edge]});
+    }
+  }
+
+  return graph;
+}
+
+/**
+ * Parse graph in text format (see parseGraph) directly in CSR format
+ * @tparam W Type of the weights
+ * @param first Start of the buffer with the graph
+ * @param last End of the buffer with the graph
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Graph stored in compressed sparse row format
+ */
+template<typename W = Weight>
+BasicCsrGraph<W> parseCsrGraph(const char* first, const char* last,
+                               unsigned int num_threads = 0) {
+  auto chunks = detail::parseChunks<W>(first, last, num_threads);
+
+  std::size_t num_nodes = 0, num_edges = 0;
+  for (const auto& chunk : chunks) {
+    num_nodes += chunk.degrees.size();
+    num_edges += chunk.targets.size();
+  }
+
+  std::vector<std::size_t> offsets(1, 0);
+  offsets.reserve(num_nodes + 1);
+  for (const auto& chunk : chunks)
+    for (auto degree : chunk.degrees)
+      offsets.push_back(offsets.back() + degree);
+
+  if (chunks.size() == 1) {
+    return BasicCsrGraph<W>(std::move(offsets),
+                            std::move(chunks[0].targets),
+                            std::move(chunks[0].weights));
+  }
+
+  std::vector<Key> targets;
+  std::vector<W> weights;
+  targets.reserve(num_edges);
+  weights.reserve(num_edges);
+  for (const auto& chunk : chunks) {
+    targets.insert(targets.end(), chunk.targets.begin(), chunk.targets.end());
+    weights.insert(weights.end(), chunk.weights.begin(), chunk.weights.end());
+  }
+
+  return BasicCsrGraph<W>(std::move(offsets),
+                          std::move(targets),
+                          std::move(weights));
+}
+
+/**
+ * Read graph in text format (see parseGraph) from a stream
+ * @tparam W Type of the weights
+ * @param is Input stream with the graph
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Graph stored as adjacency lists
+ */
+template<typename W = Weight>
+BasicGraph<W> readGraph(std::istream& is, unsigned int num_threads = 0) {
+  std::string buffer{ std::istreambuf_iterator<char>(is),
+                      std::istreambuf_iterator<char>() };
+  return parseGraph<W>(buffer.data(), buffer.data() + buffer.size(),
+                       num_threads);
+}
+
+/**
+ * Load graph in text format (see parseGraph) from a file
+ * @tparam W Type of the weights
+ * @param path Path of the file
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Graph stored as adjacency lists
+ */
+template<typename W = Weight>
+BasicGraph<W> loadGraph(const std::string& path,
+                        unsigned int num_threads = 0) {
+  auto buffer = detail::readFile(path);
+  return parseGraph<W>(buffer.data(), buffer.data() + buffer.size(),
+                       num_threads);
+}
+
+/**
+ * Load graph in text format (see parseGraph) from a file in CSR format
+ * @tparam W Type of the weights
+ * @param path Path of the file
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Graph stored in compressed sparse row format
+ */
+template<typename W = Weight>
+BasicCsrGraph<W> loadCsrGraph(const std::string& path,
+                              unsigned int num_threads = 0) {
+  auto buffer = detail::readFile(path);
+  return parseCsrGraph<W>(buffer.data(), buffer.data() + buffer.size(),
+                          num_threads);
+}
+
+/**
+ * Write graph in text format, where the n-th line has the edges leaving
+ * node n as space separated (key,weight) pairs
+ * @param os Output stream where the graph will be written
+ * @param G Graph, CsrGraph or MappedGraph
+ */
+template<typename GraphType>
+void writeGraph(std::ostream& os, const GraphType& G) {
+  // Write weights with enough digits to be read back unchanged
+  auto precision
+    = os.precision(std::numeric_limits<WeightOf<GraphType>>::max_digits10);
+
+  for (Key u = 0; u < G.size(); u++) {
+    bool first = true;
+    for (const auto& edge : G[u]) {
+      if (!first) os << ' ';
+      os << edge;
+      first = false;
+    }
+    os << '\n';
+  }
+
+  os.precision(precision);
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_TEXT_GRAPH_
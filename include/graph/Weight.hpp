@@ -20,7 +20,9 @@
 #define GRAPH_WEIGHT_
 
 // Standard headers
+#include <cmath>
 #include <limits>
+#include <type_traits>
 
 namespace graph {
 
@@ -28,6 +30,30 @@ using Weight = double;
 
 constexpr Weight Infinity = std::numeric_limits<Weight>::infinity();
 
+/**
+ * @return Infinity for floating point weights, or the biggest
+ *         representable value for integral weights
+ */
+template<typename W>
+constexpr W infinity() {
+  return std::numeric_limits<W>::has_infinity
+    ? std::numeric_limits<W>::infinity()
+    : std::numeric_limits<W>::max();
+}
+
+/**
+ * Convert a weight between weight types, rounding it to the nearest
+ * value when quantizing a floating point weight to an integral one
+ * @param weight Weight to be converted
+ * @return Weight converted to type W
+ */
+template<typename W, typename V>
+W castWeight(V weight) {
+  return std::is_integral<W>::value && std::is_floating_point<V>::value
+    ? static_cast<W>(std::llround(weight))
+    : static_cast<W>(weight);
+}
+
 }  // namespace graph
 
 #endif  // GRAPH_WEIGHT_
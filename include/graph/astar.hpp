@@ -0,0 +1,98 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_ASTAR_
+#define GRAPH_ASTAR_
+
+// Standard headers
+#include <vector>
+#include <cassert>
+#include <functional>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Edge.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+#include "graph/dijkstra.hpp"
+
+namespace graph {
+
+/**
+ * Find minimum path between two nodes of a graph, visiting first the
+ * nodes whose distance from the source plus the estimated distance to
+ * the destination is the smallest
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ *         (with lazy insertion); monotone heaps such as Radix require a
+ *         consistent heuristic, which landmarks only guarantee for
+ *         integral weights, as rounding errors may break consistency
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @tparam Heuristic Callable receiving a node and returning a lower bound
+ *         of its distance to the destination (see Landmarks)
+ * @param G Graph with non-negative weights
+ * @param source Node where the path starts
+ * @param destination Node where the path ends
+ * @param heuristic Admissible heuristic, never overestimating distances
+ * @return Nodes of the minimum path, from source to destination
+ */
+template<template<typename...> class PriorityQueue,
+         typename GraphType,
+         typename Heuristic>
+std::vector<Key> astar(const GraphType& G, const Key& source,
+                       const Key& destination, Heuristic heuristic) {
+  assert(source < G.size());
+  assert(destination < G.size());
+
+  using W = WeightOf<GraphType>;
+  using Entry = BasicEdge<W>;
+
+  std::vector<W> d(G.size(), infinity<W>());
+  std::vector<W> h(G.size());
+  std::vector<Key> parent(G.size(), InvalidKey);
+
+  PriorityQueue<Entry, std::less<Entry>> Q;
+
+  d[source] = 0;
+  h[source] = heuristic(source);
+  Q.insert(Entry{source, h[source]});
+
+  while (!Q.empty()) {
+    auto min = Q.find_minimum();
+    auto u = min.key;
+    if (u == destination) break;
+    Q.delete_minimum();
+    if (min.weight > d[u] + h[u]) continue;
+    for (const auto& edge : G[u]) {
+      auto v = edge.key;
+      auto w = edge.weight;
+      if (d[v] > d[u] + w) {
+        // Estimates are computed only once, when a node is first reached
+        if (d[v] == infinity<W>()) h[v] = heuristic(v);
+        d[v] = d[u] + w;
+        parent[v] = u;
+        Q.insert(Entry{v, d[v] + h[v]});
+      }
+    }
+  }
+
+  return detail::buildPath(parent, source, destination);
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_ASTAR_
@@ -0,0 +1,126 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_BATCH_DIJKSTRA_
+#define GRAPH_BATCH_DIJKSTRA_
+
+// Standard headers
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <exception>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+
+namespace graph {
+
+/**
+ * Find minimum paths for a batch of (source, destination) pairs,
+ * sharing a single search among all destinations of the same source
+ * and running searches of different sources in parallel
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ * @tparam Strategy LazyInsertion or DecreaseKey (see dijkstra)
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param queries Pairs of nodes where each path starts and ends
+ * @param num_threads Maximum number of threads (0 for one per core),
+ *        each of them with its own workspace (see DijkstraWorkspace)
+ * @return Nodes of each minimum path, in the same order of the queries
+ *         (only the source if there is no path)
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy = LazyInsertion,
+         typename GraphType>
+std::vector<std::vector<Key>> batchDijkstra(
+    const GraphType& G, const std::vector<std::pair<Key, Key>>& queries,
+    unsigned int num_threads = 0) {
+  using Workspace
+    = DijkstraWorkspace<PriorityQueue, Strategy, WeightOf<GraphType>>;
+
+  // Queries with the same source become contiguous
+  std::vector<std::size_t> order(queries.size());
+  for (std::size_t i = 0; i < order.size(); i++) {
+    assert(queries[i].first < G.size());
+    assert(queries[i].second < G.size());
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+    [&queries](std::size_t i, std::size_t j) {
+      return queries[i].first < queries[j].first;
+    });
+
+  std::vector<std::size_t> groups;
+  for (std::size_t i = 0; i < order.size(); i++)
+    if (i == 0 || queries[order[i]].first != queries[order[i-1]].first)
+      groups.push_back(i);
+  auto num_groups = groups.size();
+  groups.push_back(order.size());
+
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  auto num_workers = std::min<std::size_t>(
+    std::max(num_threads, 1u), num_groups);
+
+  std::vector<std::vector<Key>> paths(queries.size());
+  std::vector<std::exception_ptr> errors(num_workers);
+  std::atomic<std::size_t> next_group(0);
+
+  // Workers take groups on demand, as searches may differ a lot in cost
+  auto work = [&](std::size_t worker) {
+    try {
+      Workspace workspace(G.size());
+      std::vector<Key> destinations;
+      for (auto g = next_group++; g < num_groups; g = next_group++) {
+        destinations.clear();
+        for (auto i = groups[g]; i < groups[g+1]; i++)
+          destinations.push_back(queries[order[i]].second);
+
+        auto source = queries[order[groups[g]]].first;
+        workspace.search(G, source, destinations.begin(), destinations.end());
+
+        for (auto i = groups[g]; i < groups[g+1]; i++)
+          paths[order[i]] = workspace.path_to(queries[order[i]].second);
+      }
+    } catch (...) {
+      errors[worker] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < num_workers; i++)
+    threads.emplace_back(work, i);
+  if (num_workers > 0) work(0);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (const auto& error : errors)
+    if (error) std::rethrow_exception(error);
+
+  return paths;
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_BATCH_DIJKSTRA_
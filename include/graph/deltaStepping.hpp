@@ -0,0 +1,237 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef GRAPH_DELTA_STEPPING_
+#define GRAPH_DELTA_STEPPING_
+
+// Standard headers
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <condition_variable>
+
+// Internal headers
+#include "graph/Key.hpp"
+#include "graph/Graph.hpp"
+#include "graph/Weight.hpp"
+
+namespace graph {
+namespace detail {
+
+/**
+ * @class Barrier
+ * @brief Synchronization point where a fixed number of threads wait
+ *        for each other, reusable by consecutive phases
+ */
+class Barrier {
+ public:
+  // Constructors
+  explicit Barrier(std::size_t num_threads) : num_threads(num_threads) {
+  }
+
+  // Concrete methods
+
+  /**
+   * Block until all threads have called this method
+   */
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto phase = generation;
+    if (++waiting == num_threads) {
+      waiting = 0;
+      generation++;
+      condition.notify_all();
+    } else {
+      condition.wait(lock, [this, phase] { return generation != phase; });
+    }
+  }
+
+ private:
+  // Instance variables
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::size_t num_threads;
+  std::size_t waiting = 0;
+  std::size_t generation = 0;
+};
+
+/**
+ * Lower a distance shared among threads
+ * @param distance Current distance
+ * @param candidate New distance
+ * @return Whether candidate was smaller than the current distance
+ */
+template<typename W>
+bool relaxDistance(std::atomic<W>& distance, const W& candidate) {
+  auto current = distance.load(std::memory_order_relaxed);
+  while (candidate < current) {
+    if (distance.compare_exchange_weak(current, candidate,
+                                       std::memory_order_relaxed))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace detail
+
+/**
+ * Find minimum distances from a node to all nodes of a graph, settling
+ * nodes in buckets of width delta whose edges are relaxed in parallel:
+ * light edges (weight up to delta) until the bucket stays empty, then
+ * heavy edges of all nodes removed from the bucket
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param source Node where the paths start
+ * @param delta Width of the buckets; small values approach dijkstra and
+ *        large values approach Bellman-Ford (max weight divided by the
+ *        average degree is a good start for random graphs)
+ * @param num_threads Maximum number of threads (0 for one per core)
+ * @return Distances from source to each node (infinity if unreachable),
+ *         the same found by dijkstra
+ */
+template<typename GraphType>
+std::vector<WeightOf<GraphType>> deltaStepping(
+    const GraphType& G, const Key& source,
+    const WeightOf<GraphType>& delta, unsigned int num_threads = 0) {
+  using W = WeightOf<GraphType>;
+
+  assert(source < G.size());
+  assert(delta > 0);
+
+  // Nodes of the frontier taken by a thread at a time
+  const std::size_t chunk_size = 64;
+
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  num_threads = std::max(num_threads, 1u);
+
+  std::vector<std::atomic<W>> d(G.size());
+  for (auto& distance : d)
+    distance.store(infinity<W>(), std::memory_order_relaxed);
+
+  // Bucket (plus one) where each node was last removed
+  std::vector<std::atomic<std::size_t>> removed_in(G.size());
+  for (auto& bucket : removed_in)
+    bucket.store(0, std::memory_order_relaxed);
+
+  // Each thread inserts the nodes it relaxes in its own buckets
+  std::vector<std::vector<std::vector<Key>>> buckets(num_threads);
+  std::vector<std::vector<Key>> removed(num_threads);
+
+  // Shared state, only changed by the first thread between barriers
+  const auto none = std::numeric_limits<std::size_t>::max();
+  std::size_t current = 0;
+  std::vector<Key> frontier;
+  std::atomic<std::size_t> next(0);
+
+  detail::Barrier barrier(num_threads);
+
+  auto bucket_of = [&delta](const W& distance) {
+    return static_cast<std::size_t>(distance / delta);
+  };
+
+  auto relax = [&](unsigned int t, const Key& v, const W& candidate) {
+    if (!detail::relaxDistance(d[v], candidate)) return;
+    auto b = bucket_of(candidate);
+    if (buckets[t].size() <= b) buckets[t].resize(b+1);
+    buckets[t][b].push_back(v);
+  };
+
+  auto gather = [&] {
+    frontier.clear();
+    for (auto& own : buckets) {
+      if (current >= own.size()) continue;
+      frontier.insert(frontier.end(), own[current].begin(), own[current].end());
+      own[current].clear();
+    }
+    next.store(0);
+  };
+
+  auto advance = [&] {
+    auto first = none;
+    for (const auto& own : buckets) {
+      for (auto b = current; b < own.size() && b < first; b++) {
+        if (!own[b].empty()) { first = b; break; }
+      }
+    }
+    current = first;
+    if (current != none) gather();
+  };
+
+  auto work = [&](unsigned int t) {
+    while (true) {
+      barrier.wait();
+      if (t == 0) advance();
+      barrier.wait();
+      if (current == none) break;
+
+      // Light edges, while relaxations refill the current bucket
+      while (true) {
+        for (auto i = next.fetch_add(chunk_size); i < frontier.size();
+             i = next.fetch_add(chunk_size)) {
+          auto end = std::min(i + chunk_size, frontier.size());
+          for (auto j = i; j < end; j++) {
+            auto u = frontier[j];
+            auto du = d[u].load(std::memory_order_relaxed);
+            if (bucket_of(du) != current) continue;  // Outdated entry
+            if (removed_in[u].exchange(current+1) != current+1)
+              removed[t].push_back(u);
+            for (const auto& edge : G[u])
+              if (edge.weight <= delta) relax(t, edge.key, du + edge.weight);
+          }
+        }
+        barrier.wait();
+        if (t == 0) gather();
+        barrier.wait();
+        if (frontier.empty()) break;
+      }
+
+      // Heavy edges, which never lead back to the current bucket
+      for (const auto& u : removed[t]) {
+        auto du = d[u].load(std::memory_order_relaxed);
+        for (const auto& edge : G[u])
+          if (edge.weight > delta) relax(t, edge.key, du + edge.weight);
+      }
+      removed[t].clear();
+    }
+  };
+
+  d[source].store(0);
+  buckets[0].resize(1, std::vector<Key>(1, source));
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1; t < num_threads; t++)
+    threads.emplace_back(work, t);
+  work(0);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  std::vector<W> distances(G.size());
+  for (std::size_t u = 0; u < G.size(); u++)
+    distances[u] = d[u].load(std::memory_order_relaxed);
+  return distances;
+}
+
+}  // namespace graph
+
+#endif  // GRAPH_DELTA_STEPPING_
@@ -23,47 +23,199 @@
 #include <vector>
 #include <limits>
 #include <cassert>
+#include <cstddef>
 #include <utility>
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 
 // Internal headers
 #include "graph/Key.hpp"
 #include "graph/Edge.hpp"
 #include "graph/Graph.hpp"
+#include "graph/CsrGraph.hpp"
 #include "graph/Weight.hpp"
 
 namespace graph {
 
-template<template<typename K, typename Comparator> class PriorityQueue>
-std::vector<Key> dijkstra(const Graph& G, const Key& source,
-                                          const Key& destination) {
-  assert(source < G.size());
-  assert(destination < G.size());
+/**
+ * @class LazyInsertion
+ * @brief Dijkstra strategy that inserts a new entry in the priority queue
+ *        at every relaxation, skipping outdated entries when extracted
+ */
+struct LazyInsertion {};
 
-  std::vector<Key> parent(G.size(), InvalidKey);
-  std::vector<Weight> d(G.size(), Infinity);
+/**
+ * @class DecreaseKey
+ * @brief Dijkstra strategy that keeps one handle per vertex in the
+ *        priority queue, decreasing its key at every relaxation
+ */
+struct DecreaseKey {};
+
+namespace detail {
+
+/**
+ * @class NoTracking
+ * @brief List of touched nodes that discards them, for searches whose
+ *        buffers are not reused
+ */
+struct NoTracking {
+  void push_back(const Key& /* u */) {
+  }
+};
+
+/**
+ * @class NoHandles
+ * @brief Handles of the strategies that do not keep them
+ */
+struct NoHandles {
+  void assign(std::size_t /* n */) {
+  }
+
+  void reset(const Key& /* u */) {
+  }
+};
+
+/**
+ * @class Handles
+ * @brief One handle per node of the graph, to decrease their keys
+ */
+template<typename Queue>
+struct Handles : public std::vector<typename Queue::node_ptr> {
+  void assign(std::size_t n) {
+    std::vector<typename Queue::node_ptr>::assign(n, {});
+  }
+
+  void reset(const Key& u) {
+    (*this)[u] = {};
+  }
+};
+
+/**
+ * Handles kept by each strategy
+ */
+template<typename Queue, typename Strategy>
+using HandlesOf = typename std::conditional<
+  std::is_same<Strategy, DecreaseKey>::value,
+  Handles<Queue>, NoHandles>::type;
+
+/**
+ * @class StopAt
+ * @brief Stop condition of searches that end when destination is settled
+ *        (or never, if destination is InvalidKey)
+ */
+struct StopAt {
+  Key destination;
 
-  PriorityQueue<Edge, std::less<Edge>> Q;
+  bool operator()(const Key& u) const {
+    return u == destination;
+  }
+};
+
+/**
+ * @class StopAtAll
+ * @brief Stop condition of searches that end when all nodes marked as
+ *        pending are settled, unmarking them along the way
+ */
+struct StopAtAll {
+  std::vector<bool>& pending;
+  std::size_t& remaining;
+
+  bool operator()(const Key& u) const {
+    if (!pending[u]) return false;
+    pending[u] = false;
+    return --remaining == 0;
+  }
+};
 
-  d[source] = 0.0;
-  Q.insert(Edge{source, d[source]});
+template<typename Queue, typename GraphType, typename W,
+         typename Touched, typename Stop>
+void dijkstra(const GraphType& G, const Key& source, Stop stop,
+              std::vector<W>& d, std::vector<Key>& parent,
+              Queue& Q, NoHandles& /* handle */, Touched& touched,
+              LazyInsertion /* strategy */) {
+  using Entry = BasicEdge<W>;
+
+  d[source] = 0;
+  touched.push_back(source);
+  Q.insert(Entry{source, d[source]});
 
   while (!Q.empty()) {
-    auto u = Q.find_minimum().key;
-    if (u == destination) break;
+    auto min = Q.find_minimum();
+    auto u = min.key;
+    if (min.weight > d[u]) { Q.delete_minimum(); continue; }
+    if (stop(u)) break;
     Q.delete_minimum();
-    for (unsigned int i = 0; i < G[u].size(); i++) {
-      auto v = G[u][i].key;
-      auto w = G[u][i].weight;
+    for (const auto& edge : G[u]) {
+      auto v = edge.key;
+      auto w = edge.weight;
       if (d[v] > d[u] + w) {
+        if (d[v] == infinity<W>()) touched.push_back(v);
         d[v] = d[u] + w;
         parent[v] = u;
-        Q.insert(Edge{v, d[v]});
+        Q.insert(Entry{v, d[v]});
       }
     }
   }
+}
+
+template<typename Queue, typename GraphType, typename W,
+         typename Touched, typename Stop>
+void dijkstra(const GraphType& G, const Key& source, Stop stop,
+              std::vector<W>& d, std::vector<Key>& parent,
+              Queue& Q, Handles<Queue>& handle, Touched& touched,
+              DecreaseKey /* strategy */) {
+  using Entry = BasicEdge<W>;
 
+  d[source] = 0;
+  touched.push_back(source);
+  handle[source] = Q.insert(Entry{source, d[source]});
+
+  while (!Q.empty()) {
+    auto u = Q.find_minimum().key;
+    if (stop(u)) break;
+    Q.delete_minimum();
+    for (const auto& edge : G[u]) {
+      auto v = edge.key;
+      auto w = edge.weight;
+      if (d[v] > d[u] + w) {
+        if (d[v] == infinity<W>()) {
+          d[v] = d[u] + w;
+          touched.push_back(v);
+          handle[v] = Q.insert(Entry{v, d[v]});
+        } else {
+          d[v] = d[u] + w;
+          Q.decrease_key(handle[v], Entry{v, d[v]});
+        }
+        parent[v] = u;
+      }
+    }
+  }
+}
+
+template<template<typename...> class PriorityQueue,
+         typename GraphType, typename W, typename Strategy>
+void dijkstra(const GraphType& G, const Key& source, const Key& destination,
+              std::vector<W>& d, std::vector<Key>& parent,
+              Strategy strategy) {
+  using Queue = PriorityQueue<BasicEdge<W>, std::less<BasicEdge<W>>>;
+
+  Queue Q;
+  HandlesOf<Queue, Strategy> handle;
+  handle.assign(G.size());
+  NoTracking touched;
+
+  dijkstra(G, source, StopAt{destination}, d, parent, Q, handle, touched,
+           strategy);
+}
+
+/**
+ * @return Nodes of the path from source to destination in the tree
+ *         given by parent, or only the source if there is no such path
+ */
+inline std::vector<Key> buildPath(const std::vector<Key>& parent,
+                                  const Key& source,
+                                  const Key& destination) {
   std::vector<Key> path;
   for (Key p = destination; parent[p] != InvalidKey; p = parent[p])
     path.push_back(p);
@@ -74,6 +226,418 @@ std::vector<Key> dijkstra(const Graph& G, const Key& source,
   return path;
 }
 
+/**
+ * Settle the next vertex of one direction of a bidirectional search,
+ * updating the best path found so far whenever an edge reaches a
+ * vertex already reached by the search in the other direction
+ */
+template<typename Queue, typename GraphType, typename W>
+void settleNext(Queue& Q, const GraphType& G,
+                std::vector<W>& d, std::vector<Key>& parent,
+                const std::vector<W>& other_d,
+                W& best, Key& meeting) {
+  using Entry = BasicEdge<W>;
+
+  auto min = Q.find_minimum();
+  auto u = min.key;
+  Q.delete_minimum();
+  if (min.weight > d[u]) return;
+
+  for (const auto& edge : G[u]) {
+    auto v = edge.key;
+    auto w = edge.weight;
+    if (d[v] > d[u] + w) {
+      d[v] = d[u] + w;
+      parent[v] = u;
+      Q.insert(Entry{v, d[v]});
+    }
+    if (other_d[v] != infinity<W>() && d[u] + w + other_d[v] < best) {
+      best = d[u] + w + other_d[v];
+      meeting = v;
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @class BasicShortestPathTree
+ * @brief Distances and minimum paths from a source to all nodes of a
+ *        graph, with weights of type W
+ */
+template<typename W>
+struct BasicShortestPathTree {
+  Key source = InvalidKey;
+  std::vector<W> distance;
+  std::vector<Key> parent;
+
+  /**
+   * @param destination Node of the graph
+   * @return Whether there is a path from source to destination
+   */
+  bool reaches(const Key& destination) const {
+    return distance[destination] != infinity<W>();
+  }
+
+  /**
+   * @param destination Node where the path ends
+   * @return Nodes of the minimum path, from source to destination, as
+   *         returned by dijkstra
+   */
+  std::vector<Key> path_to(const Key& destination) const {
+    assert(destination < parent.size());
+    return detail::buildPath(parent, source, destination);
+  }
+};
+
+using ShortestPathTree = BasicShortestPathTree<Weight>;
+
+/**
+ * Find minimum paths from one node to all nodes of a graph, storing
+ * them in buffers provided by the caller, whose capacity is reused
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ * @tparam Strategy LazyInsertion or DecreaseKey
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param source Node where the paths start
+ * @param d Distance from source to each node (infinity if unreachable)
+ * @param parent Node before each node in its minimum path (InvalidKey
+ *        for the source and for unreachable nodes)
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy = LazyInsertion,
+         typename GraphType>
+void shortestPathTree(const GraphType& G, const Key& source,
+                      std::vector<WeightOf<GraphType>>& d,
+                      std::vector<Key>& parent) {
+  assert(source < G.size());
+
+  using W = WeightOf<GraphType>;
+
+  d.assign(G.size(), infinity<W>());
+  parent.assign(G.size(), InvalidKey);
+
+  detail::dijkstra<PriorityQueue>(G, source, InvalidKey, d, parent,
+                                  Strategy{});
+}
+
+/**
+ * Find minimum paths from one node to all nodes of a graph
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ * @tparam Strategy LazyInsertion or DecreaseKey
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param source Node where the paths start
+ * @return Tree with the minimum paths from source
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy = LazyInsertion,
+         typename GraphType>
+BasicShortestPathTree<WeightOf<GraphType>> shortestPathTree(
+    const GraphType& G, const Key& source) {
+  BasicShortestPathTree<WeightOf<GraphType>> tree;
+  tree.source = source;
+  shortestPathTree<PriorityQueue, Strategy>(G, source,
+                                            tree.distance, tree.parent);
+  return tree;
+}
+
+/**
+ * Find minimum path between two nodes of a graph
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ * @tparam Strategy LazyInsertion or DecreaseKey
+ * @tparam GraphType Graph or CsrGraph (any type whose size() is the number
+ *         of nodes and whose operator[] returns a range of edges), with
+ *         any weight type (see WeightOf)
+ * @param G Graph with non-negative weights
+ * @param source Node where the path starts
+ * @param destination Node where the path ends
+ * @return Nodes of the minimum path, from source to destination
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy = LazyInsertion,
+         typename GraphType>
+std::vector<Key> dijkstra(const GraphType& G, const Key& source,
+                                              const Key& destination) {
+  assert(source < G.size());
+  assert(destination < G.size());
+
+  std::vector<Key> parent(G.size(), InvalidKey);
+  using W = WeightOf<GraphType>;
+
+  std::vector<W> d(G.size(), infinity<W>());
+
+  detail::dijkstra<PriorityQueue>(G, source, destination, d, parent,
+                                  Strategy{});
+
+  return detail::buildPath(parent, source, destination);
+}
+
+/**
+ * @class DijkstraWorkspace
+ * @brief Buffers of dijkstra kept between queries: only the entries
+ *        touched by a query are reset before the next one, and the
+ *        priority queue is cleared keeping its memory
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy = LazyInsertion,
+         typename W = Weight>
+class DijkstraWorkspace {
+ public:
+  // Aliases
+  using weight_type = W;
+  using queue_type = PriorityQueue<BasicEdge<W>, std::less<BasicEdge<W>>>;
+
+  // Constructors
+  DijkstraWorkspace() = default;
+
+  explicit DijkstraWorkspace(std::size_t num_nodes) {
+    prepare(num_nodes);
+  }
+
+  // Concrete methods
+
+  /**
+   * Reset buffers for a new query in time O(t), where t is the number
+   * of nodes touched by the last query, or O(n) if the number of nodes
+   * changed
+   * @param num_nodes Number of nodes of the graph of the new query
+   */
+  void prepare(std::size_t num_nodes) {
+    if (d.size() != num_nodes) {
+      d.assign(num_nodes, infinity<W>());
+      parent.assign(num_nodes, InvalidKey);
+      handle.assign(num_nodes);
+    } else {
+      for (auto u : touched) {
+        d[u] = infinity<W>();
+        parent[u] = InvalidKey;
+        handle.reset(u);
+      }
+    }
+    touched.clear();
+    Q.clear();
+    origin = InvalidKey;
+  }
+
+  /**
+   * Search minimum paths from source, stopping when destination is
+   * settled (or exploring all nodes if destination is InvalidKey)
+   * @param G Graph with non-negative weights of type W
+   * @param source Node where the paths start
+   * @param destination Node where the search may stop
+   */
+  template<typename GraphType>
+  void search(const GraphType& G, const Key& source,
+              const Key& destination = InvalidKey) {
+    assert(source < G.size());
+    assert(destination == InvalidKey || destination < G.size());
+    static_assert(std::is_same<WeightOf<GraphType>, W>::value,
+                  "Workspace and graph must have the same weight type");
+
+    prepare(G.size());
+    origin = source;
+    detail::dijkstra(G, source, detail::StopAt{destination}, d, parent,
+                     Q, handle, touched, Strategy{});
+  }
+
+  /**
+   * Search minimum paths from source, stopping when all destinations in
+   * the range [first, last) are settled
+   * @param G Graph with non-negative weights of type W
+   * @param source Node where the paths start
+   * @param first Iterator to the first destination
+   * @param last Iterator past the last destination
+   */
+  template<typename GraphType, typename InputIterator>
+  void search(const GraphType& G, const Key& source,
+              InputIterator first, InputIterator last) {
+    assert(source < G.size());
+    static_assert(std::is_same<WeightOf<GraphType>, W>::value,
+                  "Workspace and graph must have the same weight type");
+
+    prepare(G.size());
+    origin = source;
+    pending.resize(G.size(), false);
+
+    std::size_t remaining = 0;
+    for (auto it = first; it != last; ++it) {
+      assert(*it < G.size());
+      if (!pending[*it]) remaining++;
+      pending[*it] = true;
+    }
+    if (remaining == 0) return;
+
+    detail::dijkstra(G, source, detail::StopAtAll{pending, remaining},
+                     d, parent, Q, handle, touched, Strategy{});
+
+    // Unreachable destinations are still pending
+    for (auto it = first; it != last; ++it)
+      pending[*it] = false;
+  }
+
+  /**
+   * @param u Node of the graph
+   * @return Distance from the source of the last search to u
+   */
+  W distance(const Key& u) const {
+    return d[u];
+  }
+
+  /**
+   * @return Distances from the source of the last search (infinity for
+   *         nodes it did not reach)
+   */
+  const std::vector<W>& distances() const {
+    return d;
+  }
+
+  /**
+   * @return Node before each node in the minimum paths of the last search
+   */
+  const std::vector<Key>& parents() const {
+    return parent;
+  }
+
+  /**
+   * @param destination Node where the path ends
+   * @return Nodes of the minimum path found by the last search, from its
+   *         source to destination, as returned by dijkstra
+   */
+  std::vector<Key> path_to(const Key& destination) const {
+    assert(destination < parent.size());
+    return detail::buildPath(parent, origin, destination);
+  }
+
+  /**
+   * @return Nodes touched by the last search
+   */
+  const std::vector<Key>& touched_nodes() const {
+    return touched;
+  }
+
+ private:
+  // Instance variables
+  std::vector<W> d;
+  std::vector<Key> parent;
+  std::vector<Key> touched;
+  std::vector<bool> pending;
+  queue_type Q;
+  detail::HandlesOf<queue_type, Strategy> handle;
+  Key origin = InvalidKey;
+};
+
+/**
+ * Find minimum path between two nodes of a graph, reusing the buffers
+ * of a workspace (see DijkstraWorkspace)
+ * @param G Graph with non-negative weights
+ * @param source Node where the path starts
+ * @param destination Node where the path ends
+ * @param workspace Buffers kept between queries
+ * @return Nodes of the minimum path, from source to destination
+ */
+template<template<typename...> class PriorityQueue,
+         typename Strategy, typename W, typename GraphType>
+std::vector<Key> dijkstra(const GraphType& G, const Key& source,
+                          const Key& destination,
+                          DijkstraWorkspace<PriorityQueue, Strategy, W>&
+                            workspace) {
+  workspace.search(G, source, destination);
+  return workspace.path_to(destination);
+}
+
+/**
+ * Find minimum path between two nodes of a graph, searching forward
+ * from the source and backward from the destination at the same time
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ *         (with lazy insertion) in each direction
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @tparam ReverseGraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param R Reverse of G (see reverseGraph)
+ * @param source Node where the path starts
+ * @param destination Node where the path ends
+ * @return Nodes of the minimum path, from source to destination
+ */
+template<template<typename...> class PriorityQueue,
+         typename GraphType,
+         typename ReverseGraphType>
+std::vector<Key> bidirectionalDijkstra(const GraphType& G,
+                                       const ReverseGraphType& R,
+                                       const Key& source,
+                                       const Key& destination) {
+  assert(source < G.size());
+  assert(destination < G.size());
+  assert(R.size() == G.size());
+
+  using W = WeightOf<GraphType>;
+  using Entry = BasicEdge<W>;
+
+  std::vector<W> forward_d(G.size(), infinity<W>());
+  std::vector<W> backward_d(G.size(), infinity<W>());
+  std::vector<Key> forward_parent(G.size(), InvalidKey);
+  std::vector<Key> backward_parent(G.size(), InvalidKey);
+
+  PriorityQueue<Entry, std::less<Entry>> forward_Q, backward_Q;
+
+  forward_d[source] = 0;
+  backward_d[destination] = 0;
+  forward_Q.insert(Entry{source, 0});
+  backward_Q.insert(Entry{destination, 0});
+
+  W best = source == destination ? W(0) : infinity<W>();
+  Key meeting = source == destination ? source : InvalidKey;
+
+  // Stop when no path through unsettled vertices can beat the best one
+  while (!forward_Q.empty() && !backward_Q.empty()) {
+    auto forward_min = forward_Q.find_minimum().weight;
+    auto backward_min = backward_Q.find_minimum().weight;
+    if (best != infinity<W>() && forward_min + backward_min >= best) break;
+
+    if (forward_min <= backward_min)
+      detail::settleNext(forward_Q, G, forward_d, forward_parent,
+                         backward_d, best, meeting);
+    else
+      detail::settleNext(backward_Q, R, backward_d, backward_parent,
+                         forward_d, best, meeting);
+  }
+
+  std::vector<Key> path;
+  if (meeting == InvalidKey) {
+    path.push_back(source);
+    return path;
+  }
+
+  for (Key p = meeting; p != InvalidKey; p = forward_parent[p])
+    path.push_back(p);
+  std::reverse(path.begin(), path.end());
+  for (Key p = backward_parent[meeting]; p != InvalidKey;
+       p = backward_parent[p])
+    path.push_back(p);
+
+  return path;
+}
+
+/**
+ * Find minimum path between two nodes of a graph, searching forward
+ * from the source and backward from the destination at the same time
+ * (see bidirectionalDijkstra above), building the reverse graph first
+ * @tparam PriorityQueue Heap used to select the next node to be visited
+ * @tparam GraphType Graph or CsrGraph (see dijkstra)
+ * @param G Graph with non-negative weights
+ * @param source Node where the path starts
+ * @param destination Node where the path ends
+ * @return Nodes of the minimum path, from source to destination
+ */
+template<template<typename...> class PriorityQueue,
+         typename GraphType>
+std::vector<Key> bidirectionalDijkstra(const GraphType& G,
+                                       const Key& source,
+                                       const Key& destination) {
+  return bidirectionalDijkstra<PriorityQueue>(G, reverseGraph(G),
+                                              source, destination);
+}
+
 }  // namespace graph
 
 #endif  // GRAPH_DIJKSTRA_
@@ -0,0 +1,208 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_ALLOCATION_
+#define HEAP_ALLOCATION_
+
+// Standard headers
+#include <new>
+#include <memory>
+#include <vector>
+#include <utility>
+
+namespace heap {
+
+/**
+ * @class SharedAllocation
+ * @brief Allocation policy where every node is reference counted
+ *
+ * Nodes are kept alive by the links of the heap and by any handle held
+ * by the user, so a handle stays valid even after its node is removed.
+ */
+struct SharedAllocation {
+  // Aliases
+  template<typename Node>
+  using pointer = std::shared_ptr<Node>;
+
+  // Inner classes
+  template<typename Node>
+  class pool {
+   public:
+    // Static variables
+    static constexpr bool bulk_release = false;
+
+    // Concrete methods
+
+    /**
+     * Create a new node in time O(1)
+     * @param args Arguments to initialize the node
+     * @return Pointer to the new node
+     */
+    template<typename... Args>
+    pointer<Node> create(Args&&... args) {
+      return pointer<Node>(new Node{std::forward<Args>(args)...});
+    }
+
+    /**
+     * Take ownership of nodes created by other pool in time O(1)
+     * @param other Pool whose nodes will be adopted
+     */
+    void splice(pool& /* other */) {
+    }
+
+    /**
+     * Release all nodes created by the pool in time O(1)
+     */
+    void clear() {
+    }
+
+    /**
+     * Exchange nodes with other pool in time O(1)
+     * @param other Pool to exchange nodes with
+     */
+    void swap(pool& /* other */) {
+    }
+  };
+};
+
+/**
+ * @class ArenaAllocation
+ * @brief Allocation policy where nodes are carved from per-heap slabs
+ *
+ * Nodes are never freed individually: they stay valid until the heap
+ * is cleared or destroyed, when all slabs are released at once.
+ */
+struct ArenaAllocation {
+  // Aliases
+  template<typename Node>
+  using pointer = Node*;
+
+  // Inner classes
+  template<typename Node>
+  class pool {
+   public:
+    // Static variables
+    static constexpr bool bulk_release = true;
+    static constexpr std::size_t min_slab_size = 16;
+    static constexpr std::size_t max_slab_size = 64 * 1024;
+
+    // Constructors
+    pool() = default;
+
+    pool(const pool&) = delete;
+
+    pool(pool&& other) : slabs(std::move(other.slabs)) {
+      other.slabs.clear();
+    }
+
+    // Destructor
+    ~pool() {
+      clear();
+    }
+
+    // Overloaded operators
+    pool& operator=(pool other) {
+      swap(other);
+      return *this;
+    }
+
+    // Concrete methods
+
+    /**
+     * Create a new node in amortized time O(1)
+     * @param args Arguments to initialize the node
+     * @return Pointer to the new node
+     */
+    template<typename... Args>
+    pointer<Node> create(Args&&... args) {
+      if (slabs.empty() || slabs.back().used == slabs.back().capacity)
+        grow();
+
+      auto& current = slabs.back();
+      auto address = current.nodes + current.used;
+      new (address) Node{std::forward<Args>(args)...};
+      current.used++;
+
+      return address;
+    }
+
+    /**
+     * Take ownership of nodes created by other pool in time O(s),
+     * where s is the number of slabs of the other pool
+     * @param other Pool whose nodes will be adopted
+     */
+    void splice(pool& other) {
+      // Adopted slabs go first, so the slab being filled stays the last one
+      slabs.insert(slabs.begin(), other.slabs.begin(), other.slabs.end());
+      other.slabs.clear();
+    }
+
+    /**
+     * Release all nodes created by the pool in time O(n)
+     */
+    void clear() {
+      std::allocator<Node> allocator;
+      for (auto& s : slabs) {
+        for (std::size_t i = 0; i < s.used; i++)
+          s.nodes[i].~Node();
+        allocator.deallocate(s.nodes, s.capacity);
+      }
+      slabs.clear();
+    }
+
+    /**
+     * Exchange nodes with other pool in time O(1)
+     * @param other Pool to exchange nodes with
+     */
+    void swap(pool& other) {
+      slabs.swap(other.slabs);
+    }
+
+   private:
+    // Inner structs
+    struct slab {
+      Node* nodes;
+      std::size_t used;
+      std::size_t capacity;
+    };
+
+    // Instance variables
+    std::vector<slab> slabs;
+
+    // Concrete methods
+
+    /**
+     * Allocate a new slab, twice as big as the last one
+     */
+    void grow() {
+      std::size_t capacity = min_slab_size;
+      if (!slabs.empty() && 2 * slabs.back().capacity < max_slab_size)
+        capacity = 2 * slabs.back().capacity;
+      else if (!slabs.empty())
+        capacity = max_slab_size;
+
+      slabs.reserve(slabs.size() + 1);
+      slabs.push_back(slab{
+        std::allocator<Node>().allocate(capacity), 0, capacity });
+    }
+  };
+};
+
+}  // namespace heap
+
+#endif  // HEAP_ALLOCATION_
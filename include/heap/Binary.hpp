@@ -27,15 +27,68 @@
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <utility>
+#include <iterator>
+#include <algorithm>
 #include <functional>
 
 namespace heap {
 
+/**
+ * @class NodeStorage
+ * @brief Storage policy where each key lives in its own node, allowing
+ *        handles to be used with decrease_key and remove
+ */
+struct NodeStorage {};
+
+/**
+ * @class ValueStorage
+ * @brief Storage policy where keys are stored inline, without handles
+ */
+struct ValueStorage {};
+
+namespace detail {
+
+/**
+ * Reserve space for the keys of a range, if its size is known
+ * @param v Vector where keys will be appended
+ * @param first Iterator to the first key
+ * @param last Iterator past the last key
+ */
+template<typename T, typename ForwardIterator>
+void reserve(std::vector<T>& v, ForwardIterator first, ForwardIterator last,
+             std::forward_iterator_tag /* category */) {
+  v.reserve(v.size() + std::distance(first, last));
+}
+
+template<typename T, typename InputIterator>
+void reserve(std::vector<T>& /* v */,
+             InputIterator /* first */, InputIterator /* last */,
+             std::input_iterator_tag /* category */) {
+}
+
+/**
+ * Choose between sifting up each appended key, in time O(k lg n),
+ * and rearranging the whole heap, in time O(n)
+ * @param old_size Number of keys already arranged as a heap
+ * @param new_size Number of keys after appending k new keys
+ * @return True if rearranging the whole heap is cheaper
+ */
+inline bool prefer_make_heap(std::size_t old_size, std::size_t new_size) {
+  std::size_t lg = 0;
+  for (auto n = new_size; n > 1; n >>= 1) lg++;
+  return (new_size - old_size) * lg > new_size;
+}
+
+}  // namespace detail
+
 /**
  * @class Binary
  * @brief Binary Heap data structure
  */
-template<typename K, typename Comparator = std::less<K>>
+template<typename K,
+         typename Comparator = std::less<K>,
+         typename Storage = NodeStorage>
 class Binary {
  public:
   // Forward declaration
@@ -49,6 +102,7 @@ class Binary {
   struct node {
     // Instance variables
     key_type key;
+    std::size_t index = 0;
 
     // Operator overload
     friend bool operator<(const node_ptr& lhs, const node_ptr& rhs) {
@@ -60,10 +114,34 @@ class Binary {
   Binary() : Binary({}) {
   }
 
-  explicit Binary(std::initializer_list<key_type> keys) {
-    for (const auto& key : keys)
-      heap.emplace_back(new node{key});
-    std::make_heap(heap.begin(), heap.end());
+  explicit Binary(std::initializer_list<key_type> keys)
+      : Binary(keys.begin(), keys.end()) {
+  }
+
+  template<typename InputIterator,
+           typename = typename std::iterator_traits<
+             InputIterator>::iterator_category>
+  Binary(InputIterator first, InputIterator last) {
+    insert_bulk(first, last);
+  }
+
+  template<typename Range,
+           typename = decltype(std::begin(std::declval<const Range&>()))>
+  explicit Binary(const Range& keys)
+      : Binary(std::begin(keys), std::end(keys)) {
+  }
+
+  Binary(const Binary& bin) {
+    for (const auto& n : bin.heap)
+      heap.emplace_back(new node{n->key, n->index});
+  }
+
+  Binary(Binary&& bin) = default;
+
+  // Overloaded operators
+  Binary& operator=(Binary bin) {
+    std::swap(heap, bin.heap);
+    return *this;
   }
 
   // Concrete methods
@@ -90,12 +168,28 @@ class Binary {
    * @return Pointer to new node
    */
   node_ptr insert(key_type key) {
-    auto new_node = node_ptr(new node{key});
+    auto new_node = node_ptr(new node{key, heap.size()});
     heap.push_back(new_node);
-    std::push_heap(heap.begin(), heap.end());
+    sift_up(new_node);
     return new_node;
   }
 
+  /**
+   * Insert new nodes in time O(min(k lg n, n + k)), where k is the
+   * number of keys inserted
+   * @param first Iterator to the first key
+   * @param last Iterator past the last key
+   */
+  template<typename InputIterator>
+  void insert_bulk(InputIterator first, InputIterator last) {
+    auto old_size = heap.size();
+    detail::reserve(heap, first, last,
+      typename std::iterator_traits<InputIterator>::iterator_category{});
+    for (; first != last; ++first)
+      heap.emplace_back(new node{*first});
+    restore_heap(old_size);
+  }
+
   /**
    * Merge copy of nodes of other binary heap in time O(n)
    * @param bin Lkey reference to binary heap to be merged
@@ -106,12 +200,15 @@ class Binary {
   }
 
   /**
-   * Merge nodes of other binary heap in time O(n)
+   * Merge nodes of other binary heap in time O(min(k lg n, n + k)),
+   * where k is the size of the other heap
    * @param bin Rkey reference to binary heap to be merged
    */
   void merge(Binary&& bin) {
+    auto old_size = heap.size();
     heap.insert(heap.end(), bin.nodes().begin(), bin.nodes().end());
-    std::make_heap(heap.begin(), heap.end());
+    bin.nodes().clear();
+    restore_heap(old_size);
   }
 
   /**
@@ -127,38 +224,56 @@ class Binary {
    * @return pointer to the minimum node
    */
   node_ptr remove_minimum() {
-    std::pop_heap(heap.begin(), heap.end());
-    auto deleted = heap.back();
+    auto deleted = heap.front();
+    auto last = heap.back();
     heap.pop_back();
+
+    if (!heap.empty()) {
+      place(last, 0);
+      sift_down(last);
+    }
+
     return deleted;
   }
 
   /**
-   * Decrease key of existent node in time O(n)
-   * @return pointer to the minimum node
+   * Decrease key of existent node in time O(lg n)
+   * @param node Pointer to the node whose key will be decreased
+   * @param new_key New key of the node
    */
   void decrease_key(node_ptr& node, const key_type& new_key) {
-    if (new_key > node->key) {
+    if (Comparator()(node->key, new_key)) {
       std::ostringstream oss;
       oss << "Key " << new_key << " is bigger current key " << node->key;
       throw std::invalid_argument(oss.str());
     }
 
     node->key = new_key;
-    auto modified = std::is_heap_until(heap.begin(), heap.end());
-    if (modified != heap.end()) {
-      std::push_heap(heap.begin(),
-                     heap.begin() + std::distance(heap.begin(), modified) + 1);
-    }
+    sift_up(node);
   }
 
   /**
-   * Delete arbitrary node in amortized time O(n)
+   * Delete arbitrary node in time O(lg n)
    * @param node Pointer to node to be deleted
    */
   void remove(node_ptr& node) {
-    decrease_key(node, std::numeric_limits<key_type>::lowest());
-    delete_minimum();
+    // Move node up to the root as if its key were the lowest possible
+    auto index = node->index;
+    while (index > 0) {
+      auto parent = (index - 1) / 2;
+      place(heap[parent], index);
+      index = parent;
+    }
+    place(node, 0);
+
+    remove_minimum();
+  }
+
+  /**
+   * Remove all keys, keeping the allocated memory
+   */
+  void clear() {
+    heap.clear();
   }
 
   /**
@@ -202,6 +317,79 @@ class Binary {
   // Instance variables
   std::vector<node_ptr> heap;
 
+  // Concrete methods
+
+  /**
+   * Store node in a position of the heap, keeping track of its index
+   * @param node Node to be stored
+   * @param index Position where the node will be stored
+   */
+  void place(const node_ptr& node, std::size_t index) {
+    heap[index] = node;
+    node->index = index;
+  }
+
+  /**
+   * Move node up until its parent is not bigger than it in time O(lg n)
+   * @param node Node to be moved
+   */
+  void sift_up(const node_ptr& node) {
+    auto index = node->index;
+    while (index > 0) {
+      auto parent = (index - 1) / 2;
+      if (!Comparator()(node->key, heap[parent]->key)) break;
+      place(heap[parent], index);
+      index = parent;
+    }
+    place(node, index);
+  }
+
+  /**
+   * Move node down until its children are not smaller than it in time O(lg n)
+   * @param node Node to be moved
+   */
+  void sift_down(const node_ptr& node) {
+    auto index = node->index;
+    auto size = heap.size();
+    while (2 * index + 1 < size) {
+      auto child = 2 * index + 1;
+      if (child + 1 < size
+          && Comparator()(heap[child + 1]->key, heap[child]->key))
+        child++;
+      if (!Comparator()(heap[child]->key, node->key)) break;
+      place(heap[child], index);
+      index = child;
+    }
+    place(node, index);
+  }
+
+  /**
+   * Rearrange all nodes as a heap in time O(n)
+   */
+  void make_heap() {
+    std::make_heap(heap.begin(), heap.end());
+    for (std::size_t i = 0; i < heap.size(); i++)
+      heap[i]->index = i;
+  }
+
+  /**
+   * Rearrange nodes appended after the first old_size ones as a heap,
+   * sifting them up or rearranging all nodes, whichever is cheaper
+   * @param old_size Number of nodes already arranged as a heap
+   */
+  void restore_heap(std::size_t old_size) {
+    if (detail::prefer_make_heap(old_size, heap.size())) {
+      make_heap();
+      return;
+    }
+
+    for (auto i = old_size; i < heap.size(); i++) {
+      auto node = heap[i];
+      node->index = i;
+      sift_up(node);
+    }
+  }
+
   // Friend overloaded operators
   friend std::ostream& operator<<(std::ostream& os, const Binary& bin) {
     auto it = std::begin(bin.nodes());
@@ -218,6 +406,194 @@ class Binary {
   }
 };
 
+/**
+ * @class Binary
+ * @brief Binary Heap data structure storing keys inline
+ */
+template<typename K, typename Comparator>
+class Binary<K, Comparator, ValueStorage> {
+ public:
+  // Aliases
+  using key_type = K;
+
+  // Constructors
+  Binary() : Binary({}) {
+  }
+
+  explicit Binary(std::initializer_list<key_type> keys)
+      : Binary(keys.begin(), keys.end()) {
+  }
+
+  template<typename InputIterator,
+           typename = typename std::iterator_traits<
+             InputIterator>::iterator_category>
+  Binary(InputIterator first, InputIterator last) : heap(first, last) {
+    std::make_heap(heap.begin(), heap.end(), inverted());
+  }
+
+  template<typename Range,
+           typename = decltype(std::begin(std::declval<const Range&>()))>
+  explicit Binary(const Range& keys)
+      : Binary(std::begin(keys), std::end(keys)) {
+  }
+
+  // Concrete methods
+
+  /**
+   * Find minimum key in time O(1)
+   * @return Copy of the minimum key
+   */
+  key_type find_minimum() const {
+    return heap.front();
+  }
+
+  /**
+   * Insert new key in time O(lg n)
+   * @param key Key to be inserted
+   */
+  void insert(key_type key) {
+    heap.push_back(std::move(key));
+    std::push_heap(heap.begin(), heap.end(), inverted());
+  }
+
+  /**
+   * Insert new keys in time O(min(k lg n, n + k)), where k is the
+   * number of keys inserted
+   * @param first Iterator to the first key
+   * @param last Iterator past the last key
+   */
+  template<typename InputIterator>
+  void insert_bulk(InputIterator first, InputIterator last) {
+    auto old_size = heap.size();
+    heap.insert(heap.end(), first, last);
+    restore_heap(old_size);
+  }
+
+  /**
+   * Merge copy of keys of other binary heap in time O(min(k lg n, n + k)),
+   * where k is the size of the other heap
+   * @param bin Lkey reference to binary heap to be merged
+   */
+  void merge(const Binary& bin) {
+    insert_bulk(bin.nodes().begin(), bin.nodes().end());
+  }
+
+  /**
+   * Merge keys of other binary heap in time O(min(k lg n, n + k)),
+   * where k is the size of the other heap
+   * @param bin Rkey reference to binary heap to be merged
+   */
+  void merge(Binary&& bin) {
+    insert_bulk(std::make_move_iterator(bin.nodes().begin()),
+                std::make_move_iterator(bin.nodes().end()));
+    bin.nodes().clear();
+  }
+
+  /**
+   * Delete minimum key in time O(lg n)
+   * @return minimum key
+   */
+  key_type delete_minimum() {
+    std::pop_heap(heap.begin(), heap.end(), inverted());
+    auto deleted = std::move(heap.back());
+    heap.pop_back();
+    return deleted;
+  }
+
+  /**
+   * Remove all keys, keeping the allocated memory
+   */
+  void clear() {
+    heap.clear();
+  }
+
+  /**
+   * @return Number of elements stored in the heap
+   */
+  std::size_t size() const {
+    return heap.size();
+  }
+
+  /**
+   * @return True if heap is empty; false otherwise
+   */
+  bool empty() const {
+    return heap.empty();
+  }
+
+  /**
+   * @return List-like representation of the heap
+   */
+  std::string to_string() const {
+    std::ostringstream oss;
+    operator<<(oss, *this);
+    return oss.str();
+  }
+
+  /**
+   * @return Keys in the order they are stored in the heap
+   */
+  std::vector<key_type>& nodes() {
+    return heap;
+  }
+
+  /**
+   * @return Keys in the order they are stored in the heap
+   */
+  const std::vector<key_type>& nodes() const {
+    return heap;
+  }
+
+ private:
+  // Inner structs
+  struct inverted {
+    bool operator()(const key_type& lhs, const key_type& rhs) const {
+      return Comparator()(rhs, lhs);
+    }
+  };
+
+  // Instance variables
+  std::vector<key_type> heap;
+
+  // Concrete methods
+
+  /**
+   * Rearrange keys appended after the first old_size ones as a heap,
+   * pushing them or rearranging all keys, whichever is cheaper
+   * @param old_size Number of keys already arranged as a heap
+   */
+  void restore_heap(std::size_t old_size) {
+    if (detail::prefer_make_heap(old_size, heap.size())) {
+      std::make_heap(heap.begin(), heap.end(), inverted());
+      return;
+    }
+
+    for (auto i = old_size + 1; i <= heap.size(); i++)
+      std::push_heap(heap.begin(), heap.begin() + i, inverted());
+  }
+
+  // Friend overloaded operators
+  friend std::ostream& operator<<(std::ostream& os, const Binary& bin) {
+    auto it = std::begin(bin.nodes());
+    auto end = std::end(bin.nodes());
+
+    if (it == end) return os;
+
+    while (it != std::prev(std::end(bin.nodes()))) {
+      os << std::setw(2) << std::setfill('0') << *it << " ";
+      ++it;
+    }
+    os << std::setw(2) << std::setfill('0') << *it;
+    return os;
+  }
+};
+
+/**
+ * Binary heap storing keys inline, without handles
+ */
+template<typename K, typename Comparator = std::less<K>>
+using ValueBinary = Binary<K, Comparator, ValueStorage>;
+
 }  // namespace heap
 
 #endif  // HEAP_BINARY_
@@ -0,0 +1,330 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_DARY_
+#define HEAP_DARY_
+
+// Standard headers
+#include <memory>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+
+// Internal headers
+#include "heap/Simd.hpp"
+
+namespace heap {
+
+/**
+ * @class DAry
+ * @brief D-ary Heap data structure
+ *
+ * Keys are stored by value in a single vector, with the D children of
+ * a node stored contiguously. Handles returned by insert are indices
+ * into a table with the current position of each key. For arithmetic
+ * keys compared with std::less, the smallest child is found with SIMD
+ * instructions when the CPU supports them (see heap/Simd.hpp).
+ */
+template<typename K, typename Comparator = std::less<K>, std::size_t D = 4>
+class DAry {
+  static_assert(D >= 2, "D-ary heap should have at least 2 children per node");
+
+ public:
+  // Aliases
+  using key_type = K;
+  using node_ptr = std::size_t;
+
+  // Constructors
+  DAry() : DAry({}) {
+  }
+
+  explicit DAry(std::initializer_list<key_type> keys) {
+    for (const auto& key : keys)
+      push_back(key);
+    make_heap();
+  }
+
+  // Concrete methods
+
+  /**
+   * Find minimum key in time O(1)
+   * @return Copy of the minimum key
+   */
+  key_type find_minimum() const {
+    return heap.front();
+  }
+
+  /**
+   * Insert new key in time O(log_D n)
+   * @param key Key of the new node
+   * @return Handle to the new node
+   */
+  node_ptr insert(key_type key) {
+    auto handle = push_back(std::move(key));
+    sift_up(heap.size() - 1);
+    return handle;
+  }
+
+  /**
+   * Merge copy of keys of other d-ary heap in time O(n)
+   * @param dary Lkey reference to d-ary heap to be merged
+   */
+  void merge(const DAry& dary) {
+    auto copy = dary;
+    merge(std::move(copy));
+  }
+
+  /**
+   * Merge keys of other d-ary heap in time O(n).
+   * Handles of the other heap are not valid in this one
+   * @param dary Rkey reference to d-ary heap to be merged
+   */
+  void merge(DAry&& dary) {
+    for (auto& key : dary.heap)
+      push_back(std::move(key));
+    dary.clear();
+    make_heap();
+  }
+
+  /**
+   * Delete minimum key in time O(D log_D n)
+   * @return minimum key
+   */
+  key_type delete_minimum() {
+    auto minimum = std::move(heap.front());
+    free_handles.push_back(handles.front());
+
+    if (heap.size() > 1) {
+      place(std::move(heap.back()), handles.back(), 0);
+      heap.pop_back();
+      handles.pop_back();
+      sift_down(0);
+    } else {
+      heap.pop_back();
+      handles.pop_back();
+    }
+
+    return minimum;
+  }
+
+  /**
+   * Decrease key of existent node in time O(log_D n)
+   * @param node Handle to the node whose key will be decreased
+   * @param new_key New key of the node
+   */
+  void decrease_key(node_ptr& node, const key_type& new_key) {
+    auto index = positions[node];
+    if (Comparator()(heap[index], new_key)) {
+      std::ostringstream oss;
+      oss << "Key " << new_key << " is bigger current key " << heap[index];
+      throw std::invalid_argument(oss.str());
+    }
+
+    heap[index] = new_key;
+    sift_up(index);
+  }
+
+  /**
+   * Delete arbitrary node in time O(D log_D n)
+   * @param node Handle to node to be deleted
+   */
+  void remove(node_ptr& node) {
+    // Move node up to the root as if its key were the lowest possible
+    auto index = positions[node];
+    auto key = std::move(heap[index]);
+    while (index > 0) {
+      auto parent = (index - 1) / D;
+      place(std::move(heap[parent]), handles[parent], index);
+      index = parent;
+    }
+    place(std::move(key), node, 0);
+
+    delete_minimum();
+  }
+
+  /**
+   * Remove all keys, keeping the allocated memory
+   */
+  void clear() {
+    heap.clear();
+    handles.clear();
+    positions.clear();
+    free_handles.clear();
+  }
+
+  /**
+   * @return Number of elements stored in the heap
+   */
+  std::size_t size() const {
+    return heap.size();
+  }
+
+  /**
+   * @return True if heap is empty; false otherwise
+   */
+  bool empty() const {
+    return heap.empty();
+  }
+
+  /**
+   * @return List-like representation of the heap
+   */
+  std::string to_string() const {
+    std::ostringstream oss;
+    operator<<(oss, *this);
+    return oss.str();
+  }
+
+  /**
+   * @return Keys in the order they are stored in the heap
+   */
+  const std::vector<key_type>& nodes() const {
+    return heap;
+  }
+
+ private:
+  // Instance variables
+  std::vector<key_type> heap;
+  std::vector<node_ptr> handles;
+  std::vector<std::size_t> positions;
+  std::vector<node_ptr> free_handles;
+
+  // Concrete methods
+
+  /**
+   * Append key to the end of the heap, without restoring heap property
+   * @param key Key to be stored
+   * @return Handle to the new node
+   */
+  node_ptr push_back(key_type key) {
+    node_ptr handle;
+    if (free_handles.empty()) {
+      handle = positions.size();
+      positions.push_back(heap.size());
+    } else {
+      handle = free_handles.back();
+      free_handles.pop_back();
+      positions[handle] = heap.size();
+    }
+    heap.push_back(std::move(key));
+    handles.push_back(handle);
+    return handle;
+  }
+
+  /**
+   * Store key in a position of the heap, keeping track of its handle
+   * @param key Key to be stored
+   * @param handle Handle of the node owning the key
+   * @param index Position where the key will be stored
+   */
+  void place(key_type&& key, node_ptr handle, std::size_t index) {
+    heap[index] = std::move(key);
+    handles[index] = handle;
+    positions[handle] = index;
+  }
+
+  /**
+   * Move key up until its parent is not bigger than it in time O(log_D n)
+   * @param index Position of the key to be moved
+   */
+  void sift_up(std::size_t index) {
+    auto key = std::move(heap[index]);
+    auto handle = handles[index];
+    while (index > 0) {
+      auto parent = (index - 1) / D;
+      if (!Comparator()(key, heap[parent])) break;
+      place(std::move(heap[parent]), handles[parent], index);
+      index = parent;
+    }
+    place(std::move(key), handle, index);
+  }
+
+  /**
+   * Move key down until its children are not smaller than it
+   * in time O(D log_D n)
+   * @param index Position of the key to be moved
+   */
+  void sift_down(std::size_t index) {
+    auto key = std::move(heap[index]);
+    auto handle = handles[index];
+    auto size = heap.size();
+    while (D * index + 1 < size) {
+      auto first = D * index + 1;
+      auto last = std::min(first + D, size);
+
+      auto child = first + simd::min_index<key_type, Comparator, D>(
+        &heap[first], last - first);
+
+      if (!Comparator()(heap[child], key)) break;
+      place(std::move(heap[child]), handles[child], index);
+      index = child;
+    }
+    place(std::move(key), handle, index);
+  }
+
+  /**
+   * Rearrange all keys as a heap in time O(n)
+   */
+  void make_heap() {
+    if (heap.size() < 2) return;
+    for (auto i = (heap.size() - 2) / D + 1; i > 0; i--)
+      sift_down(i - 1);
+  }
+
+  // Friend overloaded operators
+  friend std::ostream& operator<<(std::ostream& os, const DAry& dary) {
+    auto it = std::begin(dary.nodes());
+    auto end = std::end(dary.nodes());
+
+    if (it == end) return os;
+
+    while (it != std::prev(std::end(dary.nodes()))) {
+      os << std::setw(2) << std::setfill('0') << *it << " ";
+      ++it;
+    }
+    os << std::setw(2) << std::setfill('0') << *it;
+    return os;
+  }
+};
+
+/**
+ * D-ary heap with 4 children per node
+ */
+template<typename K, typename Comparator = std::less<K>>
+using DAry4 = DAry<K, Comparator, 4>;
+
+/**
+ * D-ary heap with 8 children per node
+ */
+template<typename K, typename Comparator = std::less<K>>
+using DAry8 = DAry<K, Comparator, 8>;
+
+/**
+ * D-ary heap with 16 children per node
+ */
+template<typename K, typename Comparator = std::less<K>>
+using DAry16 = DAry<K, Comparator, 16>;
+
+}  // namespace heap
+
+#endif  // HEAP_DARY_
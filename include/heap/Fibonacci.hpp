@@ -20,24 +20,32 @@
 #define HEAP_FIBONACCI_
 
 // Standard headers
-#include <list>
-#include <cmath>
-#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <utility>
+#include <iterator>
 #include <algorithm>
 #include <functional>
 
+// Internal headers
+#include "heap/Allocation.hpp"
+
 namespace heap {
 
 /**
  * @class Fibonacci
  * @brief Fibonacci Heap data structure
+ *
+ * Roots and children are kept in intrusive sibling lists, and nodes
+ * are obtained from the given Allocation policy (SharedAllocation or
+ * ArenaAllocation).
  */
-template<typename K, typename Comparator = std::less<K>>
+template<typename K,
+         typename Comparator = std::less<K>,
+         typename Allocation = SharedAllocation>
 class Fibonacci {
  public:
   // Forward declaration
@@ -45,20 +53,24 @@ class Fibonacci {
 
   // Aliases
   using key_type = K;
-  using node_ptr = std::shared_ptr<node>;
+  using node_ptr = typename Allocation::template pointer<node>;
+  using pool_type = typename Allocation::template pool<node>;
 
   // Inner structs
   struct node {
     // Instance variables
     key_type key;
-    std::weak_ptr<node> parent = {};
-    std::list<node_ptr> children = {};
+    node_ptr child = nullptr;
+    node_ptr next = nullptr;
+    node* prev = nullptr;  // The first sibling points to the last one
+    node* parent = nullptr;
+    size_t degree = 0;
     bool marked = false;
     bool removed = false;
 
     // Concrete methods
-    bool is_root() const { return parent.expired(); }
-    size_t rank() const { return children.size(); }
+    bool is_root() const { return parent == nullptr; }
+    size_t rank() const { return degree; }
   };
 
   // Constructors
@@ -66,12 +78,39 @@ class Fibonacci {
   }
 
   explicit Fibonacci(std::initializer_list<key_type> keys)
-      : trees(make_trees(keys)), num_elements(keys.size()),
-        minimum(search_minimum()),
-        cmp([] (const node_ptr& lhs, const node_ptr& rhs) -> bool {
-          if (lhs->removed) return true;
-          return Comparator()(lhs->key, rhs->key);
-        }) {
+      : Fibonacci(keys.begin(), keys.end()) {
+  }
+
+  template<typename InputIterator,
+           typename = typename std::iterator_traits<
+             InputIterator>::iterator_category>
+  Fibonacci(InputIterator first, InputIterator last) {
+    insert_bulk(first, last);
+  }
+
+  template<typename Range,
+           typename = decltype(std::begin(std::declval<const Range&>()))>
+  explicit Fibonacci(const Range& keys)
+      : Fibonacci(std::begin(keys), std::end(keys)) {
+  }
+
+  Fibonacci(const Fibonacci& fh) : num_elements(fh.num_elements) {
+    copy_trees(trees, fh.trees, nullptr, fh);
+  }
+
+  Fibonacci(Fibonacci&& fh) : Fibonacci() {
+    swap(fh);
+  }
+
+  // Destructor
+  ~Fibonacci() {
+    clear();
+  }
+
+  // Overloaded operators
+  Fibonacci& operator=(Fibonacci fh) {
+    swap(fh);
+    return *this;
   }
 
   // Concrete methods
@@ -98,13 +137,38 @@ class Fibonacci {
    * @return Pointer to new node
    */
   node_ptr insert(key_type key) {
-    trees.emplace_back(new node{key});
+    node_ptr new_node = pool.create(key);
     num_elements++;
 
-    if (num_elements == 1u || cmp(trees.back(), minimum))
-      minimum = trees.back();
+    if (num_elements == 1u || less(raw(new_node), raw(minimum)))
+      minimum = new_node;
+
+    append(trees, new_node);
+    return new_node;
+  }
+
+  /**
+   * Insert new nodes in time O(k), where k is the number of keys inserted
+   * @param first Iterator to the first key
+   * @param last Iterator past the last key
+   */
+  template<typename InputIterator>
+  void insert_bulk(InputIterator first, InputIterator last) {
+    auto was_empty = empty();
+
+    node_ptr added = nullptr;
+    for (; first != last; ++first) {
+      append(added, pool.create(*first));
+      num_elements++;
+    }
+
+    auto added_minimum = search_minimum(added);
+    if (!added_minimum) return;
+
+    if (was_empty || less(raw(added_minimum), raw(minimum)))
+      minimum = added_minimum;
 
-    return trees.back();
+    splice(trees, added);
   }
 
   /**
@@ -112,12 +176,7 @@ class Fibonacci {
    * @param fh Lkey reference to fibonacci heap to be merged
    */
   void merge(const Fibonacci& fh) {
-    trees.insert(trees.end(), fh.roots().begin(), fh.roots().end());
-
-    num_elements += fh.size();
-
-    if (cmp(fh.get_minimum(), minimum))
-      minimum = fh.get_minimum();
+    merge(Fibonacci(fh));
   }
 
   /**
@@ -125,12 +184,17 @@ class Fibonacci {
    * @param fh Rkey reference to fibonacci heap to be merged
    */
   void merge(Fibonacci&& fh) {
-    trees.splice(trees.end(), fh.roots());
+    if (fh.empty()) return;
+
+    if (empty() || less(raw(fh.minimum), raw(minimum)))
+      minimum = fh.minimum;
 
-    num_elements += fh.size();
+    splice(trees, fh.trees);
+    pool.splice(fh.pool);
+    num_elements += fh.num_elements;
 
-    if (cmp(fh.get_minimum(), minimum))
-      minimum = fh.get_minimum();
+    fh.minimum = nullptr;
+    fh.num_elements = 0;
   }
 
   /**
@@ -147,17 +211,19 @@ class Fibonacci {
    */
   node_ptr remove_minimum() {
     // Phase 1: remove minimum and merge its children as roots [T(n) = O(lg n)]
-    auto deleted = minimum;
-    trees.remove(deleted);
+    auto deleted = unlink(trees, raw(minimum));
     num_elements--;
 
-    trees.splice(trees.end(), deleted->children);
+    for (auto child = raw(deleted->child); child; child = raw(child->next))
+      child->parent = nullptr;
+    splice(trees, deleted->child);
+    deleted->degree = 0;
 
     // Phase 2: link trees with the same rank [T(n) = O(lg n + m)]
     consolidate();
 
     // Phase 3: search new minimum [T(n) = O(lg n)]
-    minimum = search_minimum();
+    minimum = search_minimum(trees);
 
     return deleted;
   }
@@ -176,25 +242,25 @@ class Fibonacci {
 
     // Set new key
     node->key = new_key;
-    if (cmp(node, minimum))
+    if (less(raw(node), raw(minimum)))
       minimum = node;
 
     // Node is root: nothing to do
     if (node->is_root()) return;
 
     // Heap property not violated: nothing to do
-    auto parent = node->parent.lock();
-    if (cmp(parent, node)) return;
+    auto parent = node->parent;
+    if (!less(raw(node), parent)) return;
 
     // 1st child to violate heap property: parent is marked and node is cut
     if (!parent->marked) {
       mark(parent);
-      cut(node);
+      cut(raw(node));
       return;
     }
 
     // 2nd child to violate heap property: cascade cut untill non-marked/root
-    cascade_cut(node);
+    cascade_cut(raw(node));
   }
 
   /**
@@ -207,6 +273,28 @@ class Fibonacci {
     delete_minimum();
   }
 
+  /**
+   * Remove all nodes; with ArenaAllocation, memory is released in bulk
+   */
+  void clear() {
+    if (!pool_type::bulk_release) release(std::move(trees));
+    trees = nullptr;
+    minimum = nullptr;
+    num_elements = 0;
+    pool.clear();
+  }
+
+  /**
+   * Exchange nodes with other fibonacci heap in time O(1)
+   * @param fh Fibonacci heap to exchange nodes with
+   */
+  void swap(Fibonacci& fh) {
+    std::swap(trees, fh.trees);
+    std::swap(minimum, fh.minimum);
+    std::swap(num_elements, fh.num_elements);
+    pool.swap(fh.pool);
+  }
+
   /**
    * @return Number of elements stored in the heap
    */
@@ -230,116 +318,249 @@ class Fibonacci {
     return oss.str();
   }
 
+ private:
+  // Instance variables
+  node_ptr trees = nullptr;
+  size_t num_elements = 0;
+  node_ptr minimum = nullptr;
+  pool_type pool;
+
+  std::vector<node*> root_with_rank;
+
+  // Class methods
+
   /**
-   * @return List of roots of trees
+   * @return Raw pointer to node, or nullptr if there is none
    */
-  std::list<node_ptr>& roots() {
-    return trees;
+  static node* raw(const node_ptr& node) {
+    return node ? &*node : nullptr;
   }
 
   /**
-   * @return List of roots of trees
+   * Compare nodes, considering removed nodes smaller than any other
+   * @return True if lhs should be closer to the root than rhs
    */
-  const std::list<node_ptr>& roots() const {
-    return trees;
+  static bool less(const node* lhs, const node* rhs) {
+    if (lhs->removed) return true;
+    return Comparator()(lhs->key, rhs->key);
   }
 
- private:
-  // Instance variables
-  std::list<node_ptr> trees;
-  size_t num_elements = 0;
-  node_ptr minimum;
+  /**
+   * Append single node to the end of a sibling list in time O(1)
+   * @param head First node of the list
+   * @param node Node to be appended
+   */
+  static void append(node_ptr& head, node_ptr node) {
+    auto added = raw(node);
+    if (!head) {
+      added->prev = added;
+      head = std::move(node);
+      return;
+    }
+    auto tail = head->prev;
+    added->prev = tail;
+    head->prev = added;
+    tail->next = std::move(node);
+  }
+
+  /**
+   * Insert single node before other node of a sibling list in time O(1)
+   * @param head First node of the list
+   * @param position Node that will follow the inserted one
+   * @param node Node to be inserted
+   */
+  static void insert_before(node_ptr& head, node* position, node_ptr node) {
+    auto added = raw(node);
+    added->prev = position->prev;
+    if (position == raw(head)) {
+      added->next = std::move(head);
+      position->prev = added;
+      head = std::move(node);
+    } else {
+      auto previous = position->prev;
+      added->next = std::move(previous->next);
+      position->prev = added;
+      previous->next = std::move(node);
+    }
+  }
 
-  std::function<bool(const node_ptr&, const node_ptr&)> cmp;
+  /**
+   * Remove node from a sibling list in time O(1)
+   * @param head First node of the list
+   * @param node Node to be removed
+   * @return Owning pointer to the removed node
+   */
+  static node_ptr unlink(node_ptr& head, node* node) {
+    node_ptr owner;
+    if (node == raw(head)) {
+      owner = std::move(head);
+      head = std::move(owner->next);
+      if (head) head->prev = node->prev;
+    } else {
+      auto previous = node->prev;
+      owner = std::move(previous->next);
+      previous->next = std::move(owner->next);
+      if (previous->next)
+        previous->next->prev = previous;
+      else
+        head->prev = previous;
+    }
+    owner->next = nullptr;
+    owner->prev = node;
+    return owner;
+  }
+
+  /**
+   * Move all nodes of a sibling list to the end of another in time O(1)
+   * @param head First node of the list receiving the nodes
+   * @param other First node of the list being emptied
+   */
+  static void splice(node_ptr& head, node_ptr& other) {
+    if (!other) return;
+    if (!head) {
+      head = std::move(other);
+      other = nullptr;
+      return;
+    }
+    auto tail = head->prev;
+    auto other_tail = other->prev;
+    head->prev = other_tail;
+    other->prev = tail;
+    tail->next = std::move(other);
+    other = nullptr;
+  }
+
+  /**
+   * Break all links of a list of trees, so that nodes not referenced
+   * elsewhere are released without deep recursion, in time O(n)
+   * @param head First node of the list
+   */
+  static void release(node_ptr head) {
+    std::vector<node_ptr> pending;
+    if (head) pending.push_back(std::move(head));
+    while (!pending.empty()) {
+      auto node = std::move(pending.back());
+      pending.pop_back();
+      if (node->next) pending.push_back(std::move(node->next));
+      if (node->child) pending.push_back(std::move(node->child));
+      node->next = nullptr;
+      node->child = nullptr;
+      node->parent = nullptr;
+      node->prev = raw(node);
+    }
+  }
 
   // Concrete methods
 
   /**
-   * Make single node trees from list of keys
-   * @return List of trees
+   * Copy list of trees of other heap in time O(n)
+   * @param head First node of the list receiving the copies
+   * @param other First node of the list being copied
+   * @param parent Parent of the new nodes
+   * @param fh Heap whose trees are being copied
    */
-  std::list<node_ptr>
-  make_trees(const std::initializer_list<key_type>& keys) const {
-    std::list<node_ptr> trees(keys.size(), nullptr);
-    std::transform(keys.begin(), keys.end(), trees.begin(),
-        [this](const auto& k) { return std::shared_ptr<node>(new node{k}); });
-    return trees;
+  void copy_trees(node_ptr& head, const node_ptr& other,
+                  node* parent, const Fibonacci& fh) {
+    for (auto it = raw(other); it; it = raw(it->next)) {
+      node_ptr copy = pool.create(it->key);
+      copy->parent = parent;
+      copy->degree = it->degree;
+      copy->marked = it->marked;
+      copy->removed = it->removed;
+      if (it == raw(fh.minimum)) minimum = copy;
+      copy_trees(copy->child, it->child, raw(copy), fh);
+      append(head, std::move(copy));
+    }
   }
 
   /**
-   * Search minimum in time O(n)
+   * Search minimum in a list of trees in time O(n)
+   * @param head First node of the list
    * @return Pointer to the minimum node
    */
-  node_ptr search_minimum() const {
-    auto it = std::min_element(trees.begin(), trees.end(),
-        [](const auto& a, const auto& b) { return a->key < b->key; });
-    return it != trees.end() ? *it : nullptr;
+  static node_ptr search_minimum(const node_ptr& head) {
+    if (!head) return nullptr;
+
+    auto min = raw(head);
+    for (auto it = raw(head->next); it; it = raw(it->next))
+      if (less(it, min)) min = it;
+
+    return min == raw(head) ? head : min->prev->next;
   }
 
   /**
-   * Link two trees in a single tree, with minimum element being root
-   * @return Reference to the root node
+   * Link two roots in a single tree, with minimum element being root.
+   * The resulting tree takes the place of rhs in the root list
+   * @return Pointer to the root node
    */
-  const node_ptr& link(const node_ptr& lhs, const node_ptr& rhs) const {
-    if (cmp(lhs, rhs)) {
-      lhs->children.push_back(rhs);
-      rhs->parent = lhs;
+  node* link(node* lhs, node* rhs) {
+    auto lhs_owner = unlink(trees, lhs);
+    if (less(lhs, rhs)) {
+      insert_before(trees, rhs, std::move(lhs_owner));
+      add_child(lhs, unlink(trees, rhs));
       return lhs;
     } else {
-      rhs->children.push_back(lhs);
-      lhs->parent = rhs;
+      add_child(rhs, std::move(lhs_owner));
       return rhs;
     }
   }
 
+  /**
+   * Append node to the children of another in time O(1)
+   * @param parent Node that will receive the child
+   * @param child Node that will become a child
+   */
+  void add_child(node* parent, node_ptr child) {
+    child->parent = parent;
+    append(parent->child, std::move(child));
+    parent->degree++;
+  }
+
   /**
    * Shrinks root list to O(lg n) elements
    */
   void consolidate() {
     if (num_elements == 0) return;
 
-    auto max_rank = static_cast<size_t>(std::floor(std::log2(num_elements)));
-
-    using node_list_iterator = typename std::list<node_ptr>::iterator;
-    std::vector<node_list_iterator> root_with_rank(max_rank + 1, trees.end());
-
-    for (auto it = trees.begin(); it != trees.end(); ++it) {
-      auto curr_it = it;
-      ++it;
-
-      while (root_with_rank[(*curr_it)->rank()] != trees.end()) {
-        auto curr_rank = (*curr_it)->rank();
-        auto other_it = root_with_rank[curr_rank];
-
-        (*other_it) = link(*curr_it, *other_it);
+    root_with_rank.assign(root_with_rank.size(), nullptr);
 
-        root_with_rank[curr_rank] = trees.end();
-        trees.erase(curr_it);
+    auto it = raw(trees);
+    while (it) {
+      auto curr = it;
+      it = raw(it->next);
 
-        curr_it = other_it;
+      while (curr->rank() < root_with_rank.size()
+             && root_with_rank[curr->rank()] != nullptr) {
+        auto curr_rank = curr->rank();
+        auto other = root_with_rank[curr_rank];
+        root_with_rank[curr_rank] = nullptr;
+        curr = link(curr, other);
       }
 
-      root_with_rank[(*curr_it)->rank()] = curr_it;
-      --it;
+      if (curr->rank() >= root_with_rank.size())
+        root_with_rank.resize(curr->rank() + 1, nullptr);
+      root_with_rank[curr->rank()] = curr;
     }
   }
 
   /**
-   * Cut node from its parent and insert in the root list
+   * Cut node from its parent and insert in the root list in time O(1)
    * @param node Node to be cut
    */
-  void cut(node_ptr& node) {
-    node->parent.lock()->children.remove(node);
-    trees.push_back(node);
+  void cut(node* node) {
+    auto parent = node->parent;
+    auto owner = unlink(parent->child, node);
+    parent->degree--;
+    append(trees, std::move(owner));
     node->marked = false;
-    node->parent.reset();
+    node->parent = nullptr;
   }
 
   /**
    * Mark node as having a cut child (unless it's root)
    * @param node Node to be marked
    */
-  void mark(node_ptr& node) {
+  void mark(node* node) {
     if (node->is_root()) return;
     node->marked = true;
   }
@@ -348,13 +569,14 @@ class Fibonacci {
    * Cut nodes repeatedly until a non-marked/root node is found
    * @param node Node that will start cascading cut
    */
-  void cascade_cut(node_ptr node) {
-    while (!node->is_root() && node->parent.lock()->marked) {
-      auto parent = node->parent.lock();
+  void cascade_cut(node* node) {
+    while (!node->is_root() && node->parent->marked) {
+      auto parent = node->parent;
       cut(node);
       node = parent;
     }
-    auto parent = node->parent.lock();
+    if (node->is_root()) return;
+    auto parent = node->parent;
     mark(parent);
     cut(node);
   }
@@ -364,17 +586,16 @@ class Fibonacci {
    * @param os Output stream to print tree
    * @param roots list of trees to be printed
    */
-  void print_trees(std::ostream& os, const std::list<node_ptr>& roots) const {
-    for (auto it = std::begin(roots); it != std::end(roots); ++it) {
-      auto root = *it;
-      os << "(" << std::setw(2) << std::setfill('0') << root->key;
-      if (root->marked) os << "*";
-      if (!root->children.empty()) {
+  void print_trees(std::ostream& os, const node_ptr& roots) const {
+    for (auto it = raw(roots); it; it = raw(it->next)) {
+      os << "(" << std::setw(2) << std::setfill('0') << it->key;
+      if (it->marked) os << "*";
+      if (it->child) {
         os << " ";
-        print_trees(os, root->children);
+        print_trees(os, it->child);
       }
       os << ")";
-      if (it != std::prev(std::end(roots))) os << ' ';
+      if (it->next) os << ' ';
     }
   }
 
@@ -385,6 +606,12 @@ class Fibonacci {
   }
 };
 
+/**
+ * Fibonacci heap whose nodes are allocated from a per-heap arena
+ */
+template<typename K, typename Comparator = std::less<K>>
+using ArenaFibonacci = Fibonacci<K, Comparator, ArenaAllocation>;
+
 }  // namespace heap
 
 #endif  // HEAP_FIBONACCI_
@@ -0,0 +1,192 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_MULTI_QUEUE_
+#define HEAP_MULTI_QUEUE_
+
+// Standard headers
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+// Internal headers
+#include "heap/Binary.hpp"
+
+namespace heap {
+
+/**
+ * @class MultiQueue
+ * @brief Relaxed priority queue safe for concurrent callers, made of
+ *        many binary heaps protected by their own locks
+ *
+ * Keys are inserted in a random heap, and removed from the best of two
+ * random heaps, so that threads rarely wait for each other. In exchange,
+ * delete_minimum returns a key close to the minimum (with rank O(q) on
+ * average, where q is the number of heaps), not always the minimum.
+ */
+template<typename K,
+         typename Comparator = std::less<K>>
+class MultiQueue {
+ public:
+  // Aliases
+  using key_type = K;
+
+  // Static variables
+  static constexpr std::size_t queues_per_thread = 2;
+
+  // Failed attempts to lock random heaps before waiting for their locks,
+  // so that threads preempted while holding a lock are not spun on
+  static constexpr std::size_t max_attempts = 8;
+
+  // Constructors
+  MultiQueue() : MultiQueue(queues_per_thread
+                            * std::max(std::thread::hardware_concurrency(),
+                                       1u)) {
+  }
+
+  /**
+   * @param num_queues Number of internal heaps (at least 2)
+   */
+  explicit MultiQueue(std::size_t num_queues)
+      : queues(std::max<std::size_t>(num_queues, 2)) {
+  }
+
+  MultiQueue(const MultiQueue&) = delete;
+
+  // Overloaded operators
+  MultiQueue& operator=(const MultiQueue&) = delete;
+
+  // Concrete methods
+
+  /**
+   * Insert new key in a random heap in time O(lg n)
+   * @param key Key to be inserted
+   */
+  void insert(key_type key) {
+    for (std::size_t attempt = 1; ; attempt++) {
+      auto& queue = queues[random_index()];
+      std::unique_lock<std::mutex> lock(queue.mutex, std::defer_lock);
+      if (attempt < max_attempts) {
+        if (!lock.try_lock()) continue;
+      } else {
+        lock.lock();
+      }
+      queue.heap.insert(std::move(key));
+      count.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  /**
+   * Delete a key close to the minimum in time O(lg n), unless the
+   * queue looks empty
+   * @param key Where the deleted key is stored
+   * @return True if a key was deleted; false if the queue was empty
+   */
+  bool try_delete_minimum(key_type& key) {
+    for (std::size_t attempt = 1;
+         count.load(std::memory_order_relaxed) > 0; attempt++) {
+      auto i = random_index(), j = random_index();
+      if (i == j) continue;
+
+      std::unique_lock<std::mutex> first(queues[i].mutex, std::defer_lock);
+      std::unique_lock<std::mutex> second(queues[j].mutex, std::defer_lock);
+      if (attempt < max_attempts) {
+        if (!first.try_lock()) continue;
+        if (!second.try_lock()) continue;
+      } else {
+        std::lock(first, second);
+        attempt = 0;
+      }
+
+      auto& a = queues[i].heap;
+      auto& b = queues[j].heap;
+      if (a.empty() && b.empty()) continue;
+
+      auto take_a = b.empty()
+        || (!a.empty() && !Comparator()(b.find_minimum(), a.find_minimum()));
+      auto& best = take_a ? a : b;
+      key = best.delete_minimum();
+      count.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * Delete a key close to the minimum in time O(lg n)
+   * @return Deleted key
+   */
+  key_type delete_minimum() {
+    key_type key;
+    if (!try_delete_minimum(key))
+      throw std::out_of_range("Delete minimum from an empty queue");
+    return key;
+  }
+
+  /**
+   * @return Number of elements stored in the heap (exact only when no
+   *         other thread is changing it)
+   */
+  std::size_t size() const {
+    return count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return True if heap is empty; false otherwise (exact only when no
+   *         other thread is changing it)
+   */
+  bool empty() const {
+    return size() == 0;
+  }
+
+ private:
+  // Inner structs
+  struct queue {
+    std::mutex mutex;
+    ValueBinary<key_type, Comparator> heap;
+    char padding[64];  // Avoid false sharing between locks
+  };
+
+  // Instance variables
+  std::vector<queue> queues;
+  std::atomic<std::size_t> count{0};
+
+  // Concrete methods
+
+  /**
+   * @return Random index of an internal heap, drawn from a generator
+   *         owned by the calling thread
+   */
+  std::size_t random_index() {
+    thread_local std::minstd_rand generator(
+      std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return generator() % queues.size();
+  }
+};
+
+}  // namespace heap
+
+#endif  // HEAP_MULTI_QUEUE_
@@ -0,0 +1,441 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_PAIRING_
+#define HEAP_PAIRING_
+
+// Standard headers
+#include <memory>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+// Internal headers
+#include "heap/Allocation.hpp"
+
+namespace heap {
+
+/**
+ * @class Pairing
+ * @brief Pairing Heap data structure
+ *
+ * The heap is a single tree where each node points to its first child
+ * and next sibling. Nodes are obtained from the given Allocation policy
+ * (SharedAllocation or ArenaAllocation).
+ */
+template<typename K,
+         typename Comparator = std::less<K>,
+         typename Allocation = SharedAllocation>
+class Pairing {
+ public:
+  // Forward declaration
+  struct node;
+
+  // Aliases
+  using key_type = K;
+  using node_ptr = typename Allocation::template pointer<node>;
+  using pool_type = typename Allocation::template pool<node>;
+
+  // Inner structs
+  struct node {
+    // Instance variables
+    key_type key;
+    node_ptr child = nullptr;
+    node_ptr next = nullptr;
+    node* prev = nullptr;  // Previous sibling, or parent for first child
+
+    // Concrete methods
+    bool is_root() const { return prev == nullptr; }
+  };
+
+  // Constructors
+  Pairing() : Pairing({}) {
+  }
+
+  explicit Pairing(std::initializer_list<key_type> keys) {
+    for (const auto& key : keys)
+      insert(key);
+  }
+
+  Pairing(const Pairing& ph) : num_elements(ph.num_elements) {
+    copy_tree(ph.root);
+  }
+
+  Pairing(Pairing&& ph) : Pairing() {
+    swap(ph);
+  }
+
+  // Destructor
+  ~Pairing() {
+    clear();
+  }
+
+  // Overloaded operators
+  Pairing& operator=(Pairing ph) {
+    swap(ph);
+    return *this;
+  }
+
+  // Concrete methods
+
+  /**
+   * Find minimum key in time O(1)
+   * @return Copy of the minimum key
+   */
+  key_type find_minimum() const {
+    return get_minimum()->key;
+  }
+
+  /**
+   * Get minimum node in time O(1)
+   * @return Pointer to the minimum node
+   */
+  node_ptr get_minimum() const {
+    return root;
+  }
+
+  /**
+   * Insert new node in time O(1)
+   * @param key Key of the new node
+   * @return Pointer to new node
+   */
+  node_ptr insert(key_type key) {
+    node_ptr new_node = pool.create(std::move(key));
+    root = meld(std::move(root), new_node);
+    num_elements++;
+    return new_node;
+  }
+
+  /**
+   * Merge copy of nodes of other pairing heap in time O(n)
+   * @param ph Lkey reference to pairing heap to be merged
+   */
+  void merge(const Pairing& ph) {
+    merge(Pairing(ph));
+  }
+
+  /**
+   * Merge nodes of other pairing heap in time O(1)
+   * @param ph Rkey reference to pairing heap to be merged
+   */
+  void merge(Pairing&& ph) {
+    root = meld(std::move(root), std::move(ph.root));
+    pool.splice(ph.pool);
+    num_elements += ph.num_elements;
+
+    ph.root = nullptr;
+    ph.num_elements = 0;
+  }
+
+  /**
+   * Delete minimum node in amortized time O(lg n)
+   * @return minimum value stored in the minimum node
+   */
+  key_type delete_minimum() {
+    return remove_minimum()->key;
+  }
+
+  /**
+   * Remove minimum node in amortized time O(lg n)
+   * @return pointer to the minimum node
+   */
+  node_ptr remove_minimum() {
+    auto deleted = std::move(root);
+    root = pair_children(raw(deleted));
+    if (root) root->prev = nullptr;
+    num_elements--;
+    return deleted;
+  }
+
+  /**
+   * Decrease key of existent node in amortized time O(lg n)
+   * (conjectured o(lg n))
+   * @param node Pointer to the node whose key will be decreased
+   * @param new_key New key of the node
+   */
+  void decrease_key(node_ptr& node, const key_type& new_key) {
+    // Check if key is being decreased
+    if (Comparator()(node->key, new_key)) {
+      std::ostringstream oss;
+      oss << "Key " << new_key << " is bigger current key " << node->key;
+      throw std::invalid_argument(oss.str());
+    }
+
+    // Set new key
+    node->key = new_key;
+
+    // Node is root: nothing to do
+    if (node->is_root()) return;
+
+    // Cut subtree and meld it back with the root
+    root = meld(std::move(root), detach(raw(node)));
+  }
+
+  /**
+   * Delete arbitrary node in amortized time O(lg n)
+   * @param node Pointer to node to be deleted
+   */
+  void remove(node_ptr& node) {
+    if (node->is_root()) {
+      remove_minimum();
+      return;
+    }
+
+    auto subtree = detach(raw(node));
+    auto children = pair_children(raw(subtree));
+    if (children) children->prev = nullptr;
+    root = meld(std::move(root), std::move(children));
+    num_elements--;
+  }
+
+  /**
+   * Remove all nodes; with ArenaAllocation, memory is released in bulk
+   */
+  void clear() {
+    if (!pool_type::bulk_release) release(std::move(root));
+    root = nullptr;
+    num_elements = 0;
+    pool.clear();
+  }
+
+  /**
+   * Exchange nodes with other pairing heap in time O(1)
+   * @param ph Pairing heap to exchange nodes with
+   */
+  void swap(Pairing& ph) {
+    std::swap(root, ph.root);
+    std::swap(num_elements, ph.num_elements);
+    pool.swap(ph.pool);
+  }
+
+  /**
+   * @return Number of elements stored in the heap
+   */
+  std::size_t size() const {
+    return num_elements;
+  }
+
+  /**
+   * @return True if heap is empty; false otherwise
+   */
+  bool empty() const {
+    return num_elements == 0u;
+  }
+
+  /**
+   * @return SExpr-like representation of the heap
+   */
+  std::string to_string() const {
+    std::ostringstream oss;
+    operator<<(oss, *this);
+    return oss.str();
+  }
+
+ private:
+  // Instance variables
+  node_ptr root = nullptr;
+  size_t num_elements = 0;
+  pool_type pool;
+
+  std::vector<node_ptr> pairs;
+
+  // Class methods
+
+  /**
+   * @return Raw pointer to node, or nullptr if there is none
+   */
+  static node* raw(const node_ptr& node) {
+    return node ? &*node : nullptr;
+  }
+
+  /**
+   * Link two trees in a single tree, with minimum element being root
+   * @param lhs Root of the first tree (may be empty)
+   * @param rhs Root of the second tree (may be empty)
+   * @return Root of the resulting tree
+   */
+  static node_ptr meld(node_ptr lhs, node_ptr rhs) {
+    if (!lhs) return rhs;
+    if (!rhs) return lhs;
+
+    if (Comparator()(rhs->key, lhs->key)) std::swap(lhs, rhs);
+
+    // rhs becomes the first child of lhs
+    auto parent = raw(lhs);
+    auto child = raw(rhs);
+    if (parent->child) parent->child->prev = child;
+    child->next = std::move(parent->child);
+    child->prev = parent;
+    parent->child = std::move(rhs);
+
+    return lhs;
+  }
+
+  /**
+   * Cut subtree from its parent in time O(1)
+   * @param node Root of the subtree (which should not be the heap root)
+   * @return Owning pointer to the subtree
+   */
+  static node_ptr detach(node* node) {
+    auto prev = node->prev;
+
+    node_ptr owner;
+    if (raw(prev->child) == node) {
+      owner = std::move(prev->child);
+      prev->child = std::move(owner->next);
+      if (prev->child) prev->child->prev = prev;
+    } else {
+      owner = std::move(prev->next);
+      prev->next = std::move(owner->next);
+      if (prev->next) prev->next->prev = prev;
+    }
+
+    owner->next = nullptr;
+    owner->prev = nullptr;
+    return owner;
+  }
+
+  /**
+   * Break all links of a tree, so that nodes not referenced elsewhere
+   * are released without deep recursion, in time O(n)
+   * @param root Root of the tree
+   */
+  static void release(node_ptr root) {
+    std::vector<node_ptr> pending;
+    if (root) pending.push_back(std::move(root));
+    while (!pending.empty()) {
+      auto node = std::move(pending.back());
+      pending.pop_back();
+      if (node->next) pending.push_back(std::move(node->next));
+      if (node->child) pending.push_back(std::move(node->child));
+      node->next = nullptr;
+      node->child = nullptr;
+      node->prev = nullptr;
+    }
+  }
+
+  // Concrete methods
+
+  /**
+   * Meld the children of a node in two passes: left to right in pairs,
+   * then right to left into a single tree, in amortized time O(lg n)
+   * @param parent Node whose children will be melded
+   * @return Root of the resulting tree
+   */
+  node_ptr pair_children(node* parent) {
+    pairs.clear();
+
+    auto child = std::move(parent->child);
+    parent->child = nullptr;
+    while (child) {
+      auto first = std::move(child);
+      child = std::move(first->next);
+      first->next = nullptr;
+      first->prev = nullptr;
+
+      if (!child) {
+        pairs.push_back(std::move(first));
+        break;
+      }
+
+      auto second = std::move(child);
+      child = std::move(second->next);
+      second->next = nullptr;
+      second->prev = nullptr;
+
+      pairs.push_back(meld(std::move(first), std::move(second)));
+    }
+
+    node_ptr result = nullptr;
+    while (!pairs.empty()) {
+      result = meld(std::move(pairs.back()), std::move(result));
+      pairs.pop_back();
+    }
+    return result;
+  }
+
+  /**
+   * Copy tree of other heap, without deep recursion, in time O(n)
+   * @param other Root of the tree being copied
+   */
+  void copy_tree(const node_ptr& other) {
+    if (!other) return;
+
+    root = pool.create(other->key);
+
+    std::vector<std::pair<const node*, node*>> pending;
+    pending.emplace_back(raw(other), raw(root));
+    while (!pending.empty()) {
+      auto original = pending.back().first;
+      auto copy = pending.back().second;
+      pending.pop_back();
+
+      node* last = nullptr;
+      for (auto it = raw(original->child); it; it = raw(it->next)) {
+        node_ptr child = pool.create(it->key);
+        auto added = raw(child);
+        if (last) {
+          added->prev = last;
+          last->next = std::move(child);
+        } else {
+          added->prev = copy;
+          copy->child = std::move(child);
+        }
+        last = added;
+        pending.emplace_back(it, added);
+      }
+    }
+  }
+
+  /**
+   * Print tree as a SExpr
+   * @param os Output stream to print tree
+   * @param first First node of a list of siblings to be printed
+   */
+  void print_trees(std::ostream& os, const node_ptr& first) const {
+    for (auto it = raw(first); it; it = raw(it->next)) {
+      os << "(" << std::setw(2) << std::setfill('0') << it->key;
+      if (it->child) {
+        os << " ";
+        print_trees(os, it->child);
+      }
+      os << ")";
+      if (it->next) os << ' ';
+    }
+  }
+
+  // Friend overloaded operators
+  friend std::ostream& operator<<(std::ostream& os, const Pairing& ph) {
+    ph.print_trees(os, ph.root);
+    return os;
+  }
+};
+
+/**
+ * Pairing heap whose nodes are allocated from a per-heap arena
+ */
+template<typename K, typename Comparator = std::less<K>>
+using ArenaPairing = Pairing<K, Comparator, ArenaAllocation>;
+
+}  // namespace heap
+
+#endif  // HEAP_PAIRING_
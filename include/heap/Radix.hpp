@@ -0,0 +1,308 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_RADIX_
+#define HEAP_RADIX_
+
+// Standard headers
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+namespace heap {
+
+/**
+ * Priority of an arithmetic key, which is the key itself. Other key
+ * types should provide an overload of priority in their own namespace,
+ * returning an arithmetic value ordered like the keys
+ * @param key Key whose priority will be calculated
+ * @return Priority of the key
+ */
+template<typename T,
+         typename = typename std::enable_if<
+           std::is_arithmetic<T>::value>::type>
+T priority(const T& key) {
+  return key;
+}
+
+/**
+ * Map an unsigned priority to an unsigned integer preserving its order
+ * @param value Priority to be mapped
+ * @return Unsigned integer with the same order as value
+ */
+template<typename T>
+typename std::enable_if<std::is_unsigned<T>::value, std::uint64_t>::type
+to_radix(T value) {
+  return value;
+}
+
+/**
+ * Map a signed priority to an unsigned integer preserving its order
+ * @param value Priority to be mapped
+ * @return Unsigned integer with the same order as value
+ */
+template<typename T>
+typename std::enable_if<std::is_signed<T>::value
+                        && std::is_integral<T>::value, std::uint64_t>::type
+to_radix(T value) {
+  return static_cast<std::uint64_t>(static_cast<std::int64_t>(value))
+       ^ (std::uint64_t(1) << 63);
+}
+
+/**
+ * Map a floating point priority to an unsigned integer preserving its
+ * order, by flipping the bits of its IEEE 754 representation
+ * @param value Priority to be mapped (which should not be NaN)
+ * @return Unsigned integer with the same order as value
+ */
+inline std::uint64_t to_radix(double value) {
+  static_assert(sizeof(double) == sizeof(std::uint64_t)
+                && std::numeric_limits<double>::is_iec559,
+                "heap::Radix requires IEEE 754 doubles");
+
+  if (value == 0.0) value = 0.0;  // Maps -0.0 and +0.0 to the same radix
+
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits >> 63) ? ~bits : bits | (std::uint64_t(1) << 63);
+}
+
+/**
+ * Map a floating point priority to an unsigned integer preserving its
+ * order, by flipping the bits of its IEEE 754 representation
+ * @param value Priority to be mapped (which should not be NaN)
+ * @return Unsigned integer with the same order as value
+ */
+inline std::uint64_t to_radix(float value) {
+  return to_radix(static_cast<double>(value));
+}
+
+/**
+ * @class Radix
+ * @brief Radix Heap data structure
+ *
+ * Monotone priority queue: keys inserted cannot be smaller than the
+ * last minimum found. Keys are ordered by priority(key), mapped to 64
+ * bits unsigned integers, and kept in buckets by the position of the
+ * most significant bit where they differ from the last minimum.
+ * The Comparator is kept for compatibility with the other heaps, and
+ * must be std::less, as the order is given by priority(key).
+ */
+template<typename K, typename Comparator = std::less<K>>
+class Radix {
+  static_assert(std::is_same<Comparator, std::less<K>>::value,
+                "Radix heap orders keys by priority, with std::less only");
+
+ public:
+  // Aliases
+  using key_type = K;
+  using radix_type = std::uint64_t;
+
+  // Static variables
+  static constexpr std::size_t num_buckets
+    = std::numeric_limits<radix_type>::digits + 1;
+
+  // Constructors
+  Radix() : Radix({}) {
+  }
+
+  explicit Radix(std::initializer_list<key_type> keys) {
+    for (const auto& key : keys)
+      insert(key);
+  }
+
+  // Concrete methods
+
+  /**
+   * Find minimum key in amortized time O(lg C), where C is the
+   * biggest radix; no key smaller than it can be inserted afterwards
+   * @return Copy of the minimum key
+   */
+  key_type find_minimum() const {
+    pull();
+    return buckets[0].back().key;
+  }
+
+  /**
+   * Insert new key in time O(1)
+   * @param key Key to be inserted
+   */
+  void insert(key_type key) {
+    auto radix = radix_of(key);
+    if (radix < last) {
+      std::ostringstream oss;
+      oss << "Key " << key << " is smaller than last minimum";
+      throw std::invalid_argument(oss.str());
+    }
+
+    buckets[bucket_of(radix)].push_back(entry{ radix, std::move(key) });
+    num_elements++;
+  }
+
+  /**
+   * Merge copy of keys of other radix heap in time O(n)
+   * @param rh Lkey reference to radix heap to be merged
+   */
+  void merge(const Radix& rh) {
+    auto copy = rh;
+    merge(std::move(copy));
+  }
+
+  /**
+   * Merge keys of other radix heap in time O(n)
+   * @param rh Rkey reference to radix heap to be merged
+   */
+  void merge(Radix&& rh) {
+    for (auto& bucket : rh.buckets)
+      for (auto& e : bucket)
+        insert(std::move(e.key));
+    rh.clear();
+  }
+
+  /**
+   * Delete minimum key in amortized time O(lg C), where C is the
+   * biggest radix; no key smaller than it can be inserted afterwards
+   * @return minimum key
+   */
+  key_type delete_minimum() {
+    pull();
+    auto minimum = std::move(buckets[0].back().key);
+    buckets[0].pop_back();
+    num_elements--;
+    return minimum;
+  }
+
+  /**
+   * Remove all keys, keeping the memory of the buckets
+   */
+  void clear() {
+    for (auto& bucket : buckets)
+      bucket.clear();
+    last = 0;
+    num_elements = 0;
+  }
+
+  /**
+   * @return Number of elements stored in the heap
+   */
+  std::size_t size() const {
+    return num_elements;
+  }
+
+  /**
+   * @return True if heap is empty; false otherwise
+   */
+  bool empty() const {
+    return num_elements == 0u;
+  }
+
+  /**
+   * @return Keys of the heap, bucket by bucket
+   */
+  std::string to_string() const {
+    std::ostringstream oss;
+    operator<<(oss, *this);
+    return oss.str();
+  }
+
+ private:
+  // Inner structs
+  struct entry {
+    radix_type radix;
+    key_type key;
+  };
+
+  // Instance variables
+  mutable std::vector<entry> buckets[num_buckets];
+  mutable radix_type last = 0;
+  std::size_t num_elements = 0;
+
+  // Class methods
+
+  /**
+   * @param key Key whose radix will be calculated
+   * @return Unsigned integer with the order of the priority of the key
+   */
+  static radix_type radix_of(const key_type& key) {
+    return to_radix(priority(key));
+  }
+
+  // Concrete methods
+
+  /**
+   * @param radix Radix of a key not smaller than the last minimum
+   * @return Index of the bucket where the key should be stored
+   */
+  std::size_t bucket_of(radix_type radix) const {
+    auto diff = radix ^ last;
+    if (diff == 0) return 0;
+#if defined(__GNUC__)
+    return num_buckets - 1 - __builtin_clzll(diff);
+#else
+    std::size_t bucket = 0;
+    for (; diff != 0; diff >>= 1) bucket++;
+    return bucket;
+#endif
+  }
+
+  /**
+   * Move keys of the first non-empty bucket to smaller buckets, making
+   * its smallest key the last minimum, in time O(lg C) plus the number
+   * of keys moved
+   */
+  void pull() const {
+    if (!buckets[0].empty() || num_elements == 0) return;
+
+    std::size_t i = 1;
+    while (buckets[i].empty()) i++;
+
+    auto& bucket = buckets[i];
+    last = bucket[0].radix;
+    for (const auto& e : bucket)
+      if (e.radix < last) last = e.radix;
+
+    for (auto& e : bucket)
+      buckets[bucket_of(e.radix)].push_back(std::move(e));
+    bucket.clear();
+  }
+
+  // Friend overloaded operators
+  friend std::ostream& operator<<(std::ostream& os, const Radix& rh) {
+    bool first = true;
+    for (const auto& bucket : rh.buckets) {
+      for (const auto& e : bucket) {
+        if (!first) os << " ";
+        os << std::setw(2) << std::setfill('0') << e.key;
+        first = false;
+      }
+    }
+    return os;
+  }
+};
+
+}  // namespace heap
+
+#endif  // HEAP_RADIX_
@@ -0,0 +1,237 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+#ifndef HEAP_SIMD_
+#define HEAP_SIMD_
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#if !defined(HEAP_NO_SIMD) && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define HEAP_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace heap {
+namespace simd {
+
+/**
+ * Find first minimum among consecutive keys in time O(count)
+ * @param keys Pointer to the first key
+ * @param count Number of keys to be compared
+ * @return Offset of the first minimum key
+ */
+template<typename K, typename Comparator>
+std::size_t scalar_min_index(const K* keys, std::size_t count) {
+  std::size_t min = 0;
+  for (std::size_t i = 1; i < count; i++)
+    if (Comparator()(keys[i], keys[min])) min = i;
+  return min;
+}
+
+#ifdef HEAP_SIMD_AVX2
+
+/**
+ * @return True if the CPU running the program supports AVX2
+ */
+inline bool has_avx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+/**
+ * Find first minimum among N doubles with AVX2 (N multiple of 4)
+ * @param keys Pointer to the first key
+ * @return Offset of the first minimum key
+ */
+template<std::size_t N>
+__attribute__((target("avx2")))
+std::size_t avx2_min_index(const double* keys) {
+  static_assert(N % 4 == 0, "AVX2 compares doubles in groups of 4");
+
+  auto min = _mm256_loadu_pd(keys);
+  for (std::size_t i = 4; i < N; i += 4)
+    min = _mm256_min_pd(min, _mm256_loadu_pd(keys + i));
+
+  min = _mm256_min_pd(min, _mm256_permute2f128_pd(min, min, 1));
+  min = _mm256_min_pd(min, _mm256_shuffle_pd(min, min, 0x5));
+
+  for (std::size_t i = 0; i < N; i += 4) {
+    auto equal = _mm256_cmp_pd(_mm256_loadu_pd(keys + i), min, _CMP_EQ_OQ);
+    auto mask = _mm256_movemask_pd(equal);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return 0;
+}
+
+/**
+ * Find first minimum among N floats with AVX2 (N multiple of 8)
+ * @param keys Pointer to the first key
+ * @return Offset of the first minimum key
+ */
+template<std::size_t N>
+__attribute__((target("avx2")))
+std::size_t avx2_min_index(const float* keys) {
+  static_assert(N % 8 == 0, "AVX2 compares floats in groups of 8");
+
+  auto min = _mm256_loadu_ps(keys);
+  for (std::size_t i = 8; i < N; i += 8)
+    min = _mm256_min_ps(min, _mm256_loadu_ps(keys + i));
+
+  min = _mm256_min_ps(min, _mm256_permute2f128_ps(min, min, 1));
+  min = _mm256_min_ps(min, _mm256_shuffle_ps(min, min, 0x4e));
+  min = _mm256_min_ps(min, _mm256_shuffle_ps(min, min, 0xb1));
+
+  for (std::size_t i = 0; i < N; i += 8) {
+    auto equal = _mm256_cmp_ps(_mm256_loadu_ps(keys + i), min, _CMP_EQ_OQ);
+    auto mask = _mm256_movemask_ps(equal);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return 0;
+}
+
+/**
+ * Load 8 consecutive 32-bit integers in a vector register
+ * @param keys Pointer to the first integer
+ * @return Vector with the integers
+ */
+template<typename I>
+__attribute__((target("avx2")))
+__m256i avx2_load(const I* keys) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+}
+
+/**
+ * Find first minimum among N signed integers with AVX2 (N multiple of 8)
+ * @param keys Pointer to the first key
+ * @return Offset of the first minimum key
+ */
+template<std::size_t N>
+__attribute__((target("avx2")))
+std::size_t avx2_min_index(const std::int32_t* keys) {
+  static_assert(N % 8 == 0, "AVX2 compares integers in groups of 8");
+
+  auto min = avx2_load(keys);
+  for (std::size_t i = 8; i < N; i += 8)
+    min = _mm256_min_epi32(min, avx2_load(keys + i));
+
+  min = _mm256_min_epi32(min, _mm256_permute2x128_si256(min, min, 1));
+  min = _mm256_min_epi32(min, _mm256_shuffle_epi32(min, 0x4e));
+  min = _mm256_min_epi32(min, _mm256_shuffle_epi32(min, 0xb1));
+
+  for (std::size_t i = 0; i < N; i += 8) {
+    auto equal = _mm256_cmpeq_epi32(avx2_load(keys + i), min);
+    auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return 0;
+}
+
+/**
+ * Find first minimum among N unsigned integers with AVX2 (N multiple of 8)
+ * @param keys Pointer to the first key
+ * @return Offset of the first minimum key
+ */
+template<std::size_t N>
+__attribute__((target("avx2")))
+std::size_t avx2_min_index(const std::uint32_t* keys) {
+  static_assert(N % 8 == 0, "AVX2 compares integers in groups of 8");
+
+  auto min = avx2_load(keys);
+  for (std::size_t i = 8; i < N; i += 8)
+    min = _mm256_min_epu32(min, avx2_load(keys + i));
+
+  min = _mm256_min_epu32(min, _mm256_permute2x128_si256(min, min, 1));
+  min = _mm256_min_epu32(min, _mm256_shuffle_epi32(min, 0x4e));
+  min = _mm256_min_epu32(min, _mm256_shuffle_epi32(min, 0xb1));
+
+  for (std::size_t i = 0; i < N; i += 8) {
+    auto equal = _mm256_cmpeq_epi32(avx2_load(keys + i), min);
+    auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return 0;
+}
+
+#endif  // HEAP_SIMD_AVX2
+
+/**
+ * @class MinIndex
+ * @brief Search of the first minimum among the N children of a node,
+ *        vectorized when keys are arithmetic and compared with std::less
+ */
+template<typename K, typename Comparator, std::size_t N>
+struct MinIndex {
+  static std::size_t find(const K* keys, std::size_t count) {
+    return scalar_min_index<K, Comparator>(keys, count);
+  }
+};
+
+#ifdef HEAP_SIMD_AVX2
+
+/**
+ * @class VectorizedMinIndex
+ * @brief Search of the first minimum with AVX2 when all N children are
+ *        present and the CPU supports it; scalar search otherwise
+ */
+template<typename K, std::size_t N, std::size_t Lanes>
+struct VectorizedMinIndex {
+  static std::size_t find(const K* keys, std::size_t count) {
+    if (N % Lanes == 0 && count == N && has_avx2())
+      return avx2_min_index<N % Lanes == 0 ? N : Lanes>(keys);
+    return scalar_min_index<K, std::less<K>>(keys, count);
+  }
+};
+
+template<std::size_t N>
+struct MinIndex<double, std::less<double>, N>
+    : VectorizedMinIndex<double, N, 4> {};
+
+template<std::size_t N>
+struct MinIndex<float, std::less<float>, N>
+    : VectorizedMinIndex<float, N, 8> {};
+
+template<std::size_t N>
+struct MinIndex<std::int32_t, std::less<std::int32_t>, N>
+    : VectorizedMinIndex<std::int32_t, N, 8> {};
+
+template<std::size_t N>
+struct MinIndex<std::uint32_t, std::less<std::uint32_t>, N>
+    : VectorizedMinIndex<std::uint32_t, N, 8> {};
+
+#endif  // HEAP_SIMD_AVX2
+
+/**
+ * Find first minimum among the children of a node in time O(count)
+ * @tparam N Maximum number of children of a node
+ * @param keys Pointer to the first child
+ * @param count Number of children of the node
+ * @return Offset of the first minimum child
+ */
+template<typename K, typename Comparator, std::size_t N>
+std::size_t min_index(const K* keys, std::size_t count) {
+  return MinIndex<K, Comparator, N>::find(keys, count);
+}
+
+}  // namespace simd
+}  // namespace heap
+
+#endif  // HEAP_SIMD_
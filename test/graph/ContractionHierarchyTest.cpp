@@ -0,0 +1,173 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+#include <algorithm>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Radix.hpp"
+#include "heap/Binary.hpp"
+#include "heap/Pairing.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Tested header
+#include "graph/ContractionHierarchy.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::DoubleEq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ADirectedGraph : public ::testing::Test {
+  graph::Graph graph;
+
+  ADirectedGraph() : graph(6) {
+    graph[0].push_back(graph::Edge{1, 7});   // edge 0->1 weight = 7
+    graph[0].push_back(graph::Edge{2, 9});   // edge 0->2 weight = 9
+    graph[0].push_back(graph::Edge{5, 14});  // edge 0->5 weight = 14
+    graph[1].push_back(graph::Edge{2, 10});  // edge 1->2 weight = 10
+    graph[1].push_back(graph::Edge{3, 15});  // edge 1->3 weight = 15
+    graph[2].push_back(graph::Edge{5, 2});   // edge 2->5 weight = 2
+    graph[2].push_back(graph::Edge{3, 11});  // edge 2->3 weight = 11
+    graph[3].push_back(graph::Edge{4, 6});   // edge 3->4 weight = 6
+    graph[4].push_back(graph::Edge{5, 9});   // edge 4->5 weight = 9
+  }
+};
+
+struct ASparseRandomGraph : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(1000, 2000, 100.0);
+
+  graph::Weight cost(const std::vector<graph::Key>& path) const {
+    graph::Weight total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::Infinity;
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ASparseRandomGraphWithIntegralWeights, FindsPathsWithSameCost) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(1000, 2000, 100u);
+  auto hierarchy
+    = graph::buildContractionHierarchy<heap::Radix>(graph::CsrGraph(graph));
+
+  auto cost = [&graph](const std::vector<graph::Key>& path) {
+    unsigned int total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::infinity<unsigned int>();
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  };
+
+  for (graph::Key destination = 1; destination < 200; destination++) {
+    auto dijkstra_path = graph::dijkstra<heap::Radix>(graph, 0, destination);
+    auto hierarchy_path
+      = hierarchy.shortest_path<heap::Radix>(0, destination);
+    ASSERT_THAT(hierarchy_path.back(), Eq(dijkstra_path.back()));
+    ASSERT_THAT(cost(hierarchy_path), Eq(cost(dijkstra_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, HasContractionHierarchyWithAllNodesRanked) {
+  auto hierarchy = graph::buildContractionHierarchy<heap::Binary>(graph);
+
+  ASSERT_THAT(hierarchy.size(), Eq(6u));
+  ASSERT_THAT(hierarchy.num_edges(), Ge(9u));
+
+  std::vector<graph::Key> ranks;
+  for (graph::Key u = 0; u < graph.size(); u++)
+    ranks.push_back(hierarchy.rank(u));
+  std::sort(ranks.begin(), ranks.end());
+  ASSERT_THAT(ranks, ElementsAre(0, 1, 2, 3, 4, 5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenUnconnectedNodesWithHierarchy) {
+  auto hierarchy = graph::buildContractionHierarchy<heap::Binary>(graph);
+  auto minimum_path = hierarchy.shortest_path<heap::Binary>(5, 0);
+  ASSERT_THAT(minimum_path, ElementsAre(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenSameNodeWithHierarchy) {
+  auto hierarchy = graph::buildContractionHierarchy<heap::Binary>(graph);
+  auto minimum_path = hierarchy.shortest_path<heap::Binary>(0, 0);
+  ASSERT_THAT(minimum_path, ElementsAre(0));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithHierarchy) {
+  auto hierarchy = graph::buildContractionHierarchy<heap::Binary>(graph);
+  ASSERT_THAT(hierarchy.shortest_path<heap::Binary>(0, 4),
+              ElementsAre(0, 2, 3, 4));
+  ASSERT_THAT(hierarchy.shortest_path<heap::Pairing>(1, 5),
+              ElementsAre(1, 2, 5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ASparseRandomGraph, FindsPathsWithSameCostAsDijkstraUsingHierarchy) {
+  auto hierarchy = graph::buildContractionHierarchy<heap::Binary>(graph);
+
+  for (graph::Key source = 0; source < 1000; source += 97) {
+    for (graph::Key destination = 1; destination < 50; destination++) {
+      auto dijkstra_path
+        = graph::dijkstra<heap::Binary>(graph, source, destination);
+      auto hierarchy_path
+        = hierarchy.shortest_path<heap::Binary>(source, destination);
+      ASSERT_THAT(hierarchy_path.front(), Eq(source));
+      ASSERT_THAT(hierarchy_path.back(), Eq(dijkstra_path.back()));
+      ASSERT_THAT(cost(hierarchy_path), DoubleEq(cost(dijkstra_path)));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
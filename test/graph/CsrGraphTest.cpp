@@ -0,0 +1,174 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+#include <cstdint>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "graph/CsrGraph.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct AnAdjacencyListGraph : public ::testing::Test {
+  graph::Graph graph;
+
+  AnAdjacencyListGraph() : graph(4) {
+    graph[0].push_back(graph::Edge{1, 7});   // edge 0->1 weight = 7
+    graph[0].push_back(graph::Edge{2, 9});   // edge 0->2 weight = 9
+    graph[2].push_back(graph::Edge{3, 2});   // edge 2->3 weight = 2
+    graph[3].push_back(graph::Edge{0, 11});  // edge 3->0 weight = 11
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ACsrGraph, CanBeEmptyConstructed) {
+  graph::CsrGraph csr;
+
+  ASSERT_THAT(csr.size(), Eq(0u));
+  ASSERT_THAT(csr.num_edges(), Eq(0u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ACsrGraph, CanBeConvertedFromRandomGraph) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(100, 500, 10.0);
+  graph::CsrGraph csr(graph);
+
+  ASSERT_THAT(csr.size(), Eq(graph.size()));
+  ASSERT_THAT(csr.num_edges(), Eq(500u));
+
+  for (graph::Key u = 0; u < graph.size(); u++) {
+    ASSERT_THAT(csr[u].size(), Eq(graph[u].size()));
+    for (unsigned int i = 0; i < graph[u].size(); i++)
+      ASSERT_THAT(csr[u][i], Eq(graph[u][i]));
+  }
+}
+
+TEST(ARandomCsrGraph, IsTheSameForAnyNumberOfThreads) {
+  // Several ranges of vertices, generated concurrently
+  auto csr = graph::generateRandomCsrGraph(20000, 200000, 10.0, 42, 1);
+
+  for (unsigned int num_threads : { 3u, 8u }) {
+    auto other = graph::generateRandomCsrGraph(20000, 200000, 10.0, 42,
+                                               num_threads);
+    ASSERT_THAT(other.size(), Eq(csr.size()));
+    ASSERT_THAT(other.num_edges(), Eq(csr.num_edges()));
+    for (graph::Key u = 0; u < csr.size(); u++) {
+      ASSERT_THAT(other[u].size(), Eq(csr[u].size()));
+      for (unsigned int i = 0; i < csr[u].size(); i++)
+        ASSERT_THAT(other[u][i], Eq(csr[u][i]));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ARandomCsrGraph, DependsOnTheSeed) {
+  auto csr = graph::generateRandomCsrGraph(100, 500, 10.0, 1);
+  auto other = graph::generateRandomCsrGraph(100, 500, 10.0, 2);
+
+  bool same = true;
+  for (graph::Key u = 0; u < csr.size() && same; u++) {
+    same = csr[u].size() == other[u].size();
+    for (unsigned int i = 0; i < csr[u].size() && same; i++)
+      same = csr[u][i] == other[u][i];
+  }
+  ASSERT_THAT(same, Eq(false));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ARandomCsrGraph, HasEdgesWithinBounds) {
+  auto csr = graph::generateRandomCsrGraph<std::mt19937, std::uint32_t>(
+    1000, 100000, 50u, 7, 4);
+
+  ASSERT_THAT(csr.size(), Eq(1000u));
+  ASSERT_THAT(csr.num_edges(), Eq(100000u));
+  for (graph::Key u = 0; u < csr.size(); u++) {
+    for (const auto& edge : csr[u]) {
+      ASSERT_THAT(edge.key < csr.size(), Eq(true));
+      ASSERT_THAT(edge.weight <= 50u, Eq(true));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnAdjacencyListGraph, CanBeConvertedToCsrGraph) {
+  graph::CsrGraph csr(graph);
+
+  ASSERT_THAT(csr.size(), Eq(4u));
+  ASSERT_THAT(csr.num_edges(), Eq(4u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnAdjacencyListGraph, KeepsEdgesOfEachNodeInOrder) {
+  graph::CsrGraph csr(graph);
+
+  std::vector<graph::Edge> edges(csr[0].begin(), csr[0].end());
+
+  ASSERT_THAT(edges, ElementsAre(graph::Edge{1, 7}, graph::Edge{2, 9}));
+  ASSERT_THAT(csr[1].empty(), Eq(true));
+  ASSERT_THAT(csr[2][0], Eq(graph::Edge{3, 2}));
+  ASSERT_THAT(csr[3][0], Eq(graph::Edge{0, 11}));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnAdjacencyListGraph, CanBeConvertedWithFloatWeights) {
+  graph[0][0].weight = 0.25;
+  graph::BasicCsrGraph<float> csr(graph);
+
+  ASSERT_THAT(csr[0][0], Eq(graph::BasicEdge<float>{1, 0.25f}));
+  ASSERT_THAT(csr[3][0], Eq(graph::BasicEdge<float>{0, 11.0f}));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnAdjacencyListGraph, CanBeConvertedWithQuantizedWeights) {
+  graph[0][0].weight = 6.6;
+  graph[0][1].weight = 9.4;
+  graph::BasicCsrGraph<std::uint32_t> csr(graph);
+
+  ASSERT_THAT(csr[0][0].weight, Eq(7u));
+  ASSERT_THAT(csr[0][1].weight, Eq(9u));
+}
+
+/*----------------------------------------------------------------------------*/
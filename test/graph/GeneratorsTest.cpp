@@ -0,0 +1,223 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <cmath>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "graph/Generators.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Le;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct AGridGraph : public ::testing::Test {
+  graph::Graph graph = graph::generateGridGraph(
+    3, 4, std::uniform_real_distribution<graph::Weight>(1, 10));
+
+  // Vertices:  0  1  2  3
+  //            4  5  6  7
+  //            8  9 10 11
+};
+
+struct AGeometricGraph : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateGeometricGraph<std::mt19937>(2000, 0.05, 100.0);
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ARmatGraph, HasFewVerticesWithMostEdges) {
+  auto graph = graph::generateRmatGraph(
+    10, 16 * 1024, std::exponential_distribution<graph::Weight>(0.01));
+
+  std::size_t max_degree = 0, num_edges = 0;
+  for (const auto& edges : graph) {
+    max_degree = std::max(max_degree, edges.size());
+    num_edges += edges.size();
+  }
+
+  ASSERT_THAT(graph.size(), Eq(1024u));
+  ASSERT_THAT(num_edges, Eq(16 * 1024u));
+  ASSERT_THAT(max_degree, Ge(10 * num_edges / graph.size()));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ARmatGraph, PlacesAllEdgesInTopLeftQuadrantWithProbabilityOne) {
+  auto graph = graph::generateRmatGraph(
+    4, 10, std::uniform_int_distribution<unsigned int>(1, 5),
+    std::mt19937{}, 1.0, 0.0, 0.0);
+
+  ASSERT_THAT(graph.size(), Eq(16u));
+  ASSERT_THAT(graph[0].size(), Eq(10u));
+  for (const auto& edge : graph[0]) {
+    ASSERT_THAT(edge.key, Eq(0u));
+    ASSERT_THAT(edge.weight, Ge(1u));
+    ASSERT_THAT(edge.weight, Le(5u));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ASingleColumnGridGraph, LinksVerticesInAPath) {
+  auto graph = graph::generateGridGraph(
+    5, 1, std::uniform_int_distribution<unsigned int>(1, 5));
+
+  std::size_t num_edges = 0;
+  for (const auto& edges : graph)
+    num_edges += edges.size();
+
+  ASSERT_THAT(graph.size(), Eq(5u));
+  ASSERT_THAT(num_edges, Eq(8u));
+  ASSERT_THAT(graph[0].size(), Eq(1u));
+  ASSERT_THAT(graph[0][0].key, Eq(1u));
+  ASSERT_THAT(graph[4].size(), Eq(1u));
+  ASSERT_THAT(graph[4][0].key, Eq(3u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ASingleRowGridGraph, LinksVerticesInAPath) {
+  auto graph = graph::generateGridGraph(
+    1, 5, std::uniform_int_distribution<unsigned int>(1, 5));
+
+  std::size_t num_edges = 0;
+  for (const auto& edges : graph)
+    num_edges += edges.size();
+
+  ASSERT_THAT(graph.size(), Eq(5u));
+  ASSERT_THAT(num_edges, Eq(8u));
+  ASSERT_THAT(graph[0].size(), Eq(1u));
+  ASSERT_THAT(graph[0][0].key, Eq(1u));
+  ASSERT_THAT(graph[4].size(), Eq(1u));
+  ASSERT_THAT(graph[4][0].key, Eq(3u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ASparseGeometricGraph, HasExpectedAverageDegree) {
+  // Fewer cells than 1 / radius per side, as most of them would be empty
+  auto graph
+    = graph::generateGeometricGraph<std::mt19937>(20000, 0.005, 100.0);
+
+  std::size_t num_edges = 0;
+  for (const auto& edges : graph)
+    num_edges += edges.size();
+
+  auto expected = M_PI * 0.005 * 0.005 * 20000;
+  auto average = static_cast<double>(num_edges) / graph.size();
+  ASSERT_THAT(average, Ge(0.8 * expected));
+  ASSERT_THAT(average, Le(1.1 * expected));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ASparseGeometricGraph, CanHaveATinyRadius) {
+  auto graph
+    = graph::generateGeometricGraph<std::mt19937>(100000, 1e-9, 100.0);
+
+  std::size_t num_edges = 0;
+  for (const auto& edges : graph)
+    num_edges += edges.size();
+
+  ASSERT_THAT(graph.size(), Eq(100000u));
+  ASSERT_THAT(num_edges, Eq(0u));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGridGraph, LinksNeighborVertices) {
+  ASSERT_THAT(graph.size(), Eq(12u));
+  ASSERT_THAT(graph[0].size(), Eq(2u));
+  ASSERT_THAT(graph[5].size(), Eq(4u));
+  ASSERT_THAT(graph[11].size(), Eq(2u));
+
+  std::vector<graph::Key> neighbors;
+  for (const auto& edge : graph[6])
+    neighbors.push_back(edge.key);
+  std::sort(neighbors.begin(), neighbors.end());
+  ASSERT_THAT(neighbors, ElementsAre(2, 5, 7, 10));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGridGraph, HasSameWeightInBothDirections) {
+  for (graph::Key u = 0; u < graph.size(); u++) {
+    for (const auto& edge : graph[u]) {
+      ASSERT_THAT(edge.weight, Ge(1.0));
+      ASSERT_THAT(edge.weight, Le(10.0));
+
+      auto back = std::find_if(graph[edge.key].begin(), graph[edge.key].end(),
+        [u](const graph::Edge& other) { return other.key == u; });
+      ASSERT_THAT(back == graph[edge.key].end(), Eq(false));
+      ASSERT_THAT(back->weight, Eq(edge.weight));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGeometricGraph, HasExpectedAverageDegree) {
+  std::size_t num_edges = 0;
+  for (const auto& edges : graph)
+    num_edges += edges.size();
+
+  // Vertices close to the border have fewer neighbors
+  auto expected = M_PI * 0.05 * 0.05 * 2000;
+  auto average = static_cast<double>(num_edges) / graph.size();
+  ASSERT_THAT(average, Ge(0.8 * expected));
+  ASSERT_THAT(average, Le(1.1 * expected));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGeometricGraph, HasSameWeightInBothDirections) {
+  for (graph::Key u = 0; u < graph.size(); u++) {
+    for (const auto& edge : graph[u]) {
+      ASSERT_THAT(edge.key == u, Eq(false));
+      ASSERT_THAT(edge.weight, Le(100.0));
+
+      auto back = std::find_if(graph[edge.key].begin(), graph[edge.key].end(),
+        [u](const graph::Edge& other) { return other.key == u; });
+      ASSERT_THAT(back == graph[edge.key].end(), Eq(false));
+      ASSERT_THAT(back->weight, Eq(edge.weight));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,143 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <string>
+#include <vector>
+#include <cstdio>
+
+// System headers
+#include <unistd.h>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "graph/GraphCache.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::Ne;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct AGraphCacheDirectory : public ::testing::Test {
+  std::string directory;
+  std::string file_name = "/random_v"
+    + std::to_string(graph::GraphCache::generator_version)
+    + "_1000_5000_100_7.graph";
+
+  AGraphCacheDirectory() {
+    char name[] = "/tmp/heaps-cache-XXXXXX";
+    if (::mkdtemp(name)) directory = name;
+  }
+
+  ~AGraphCacheDirectory() {
+    std::remove((directory + file_name).c_str());
+    ::rmdir(directory.c_str());
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraphCache, GeneratesTheSameGraphAsGenerateRandomGraph) {
+  graph::GraphCache cache;
+  auto graph = cache.random_graph(1000, 5000, 100.0, 7);
+
+  ASSERT_THAT(*graph, Eq(graph::generateRandomGraph(1000, 5000, 100.0,
+                                                   std::mt19937{7})));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraphCache, GeneratesEachGraphOnlyOnce) {
+  graph::GraphCache cache;
+  auto graph = cache.random_graph(1000, 5000, 100.0, 7);
+  auto same_graph = cache.random_graph(1000, 5000, 100.0, 7);
+  auto other_graph = cache.random_graph(1000, 5000, 100.0, 8);
+
+  ASSERT_THAT(same_graph, Eq(graph));
+  ASSERT_THAT(other_graph, Ne(graph));
+  ASSERT_THAT(cache.size(), Eq(2u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraphCache, DiscardsLeastRecentlyUsedGraphsOverBudget) {
+  // Room for about two graphs
+  graph::GraphCache cache("", 300000);
+  cache.random_graph(1000, 5000, 100.0, 1);
+  cache.random_graph(1000, 5000, 100.0, 2);
+  cache.random_graph(1000, 5000, 100.0, 1);
+  ASSERT_THAT(cache.size(), Eq(2u));
+
+  // Graph with seed 2 is discarded
+  auto graph = cache.random_graph(1000, 5000, 100.0, 1);
+  cache.random_graph(1000, 5000, 100.0, 3);
+  ASSERT_THAT(cache.size(), Eq(2u));
+  ASSERT_THAT(cache.random_graph(1000, 5000, 100.0, 1), Eq(graph));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraphCache, KeepsDiscardedGraphsAliveWhileTheyAreUsed) {
+  // Room for only one graph
+  graph::GraphCache cache("", 150000);
+  auto graph = cache.random_graph(1000, 5000, 100.0, 1);
+  cache.random_graph(1000, 5000, 100.0, 2);
+  ASSERT_THAT(cache.size(), Eq(1u));
+
+  ASSERT_THAT(*graph, Eq(graph::generateRandomGraph(1000, 5000, 100.0,
+                                                    std::mt19937{1})));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraphCache, DoesNotKeepGraphsBiggerThanBudget) {
+  graph::GraphCache cache("", 150000);
+  auto graph = cache.random_graph(1000, 5000, 100.0, 1);
+  auto big_graph = cache.random_graph(10000, 50000, 100.0, 1);
+
+  ASSERT_THAT(cache.size(), Eq(1u));
+  ASSERT_THAT(big_graph->size(), Eq(10000u));
+  ASSERT_THAT(cache.random_graph(1000, 5000, 100.0, 1), Eq(graph));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphCacheDirectory, ReusesGraphsSavedByOtherCaches) {
+  graph::GraphCache cache(directory);
+  auto graph = cache.random_graph(1000, 5000, 100.0, 7);
+
+  std::ifstream file(directory + file_name);
+  ASSERT_THAT(file.good(), Eq(true));
+
+  graph::GraphCache other_cache(directory);
+  ASSERT_THAT(*other_cache.random_graph(1000, 5000, 100.0, 7), Eq(*graph));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -16,6 +16,9 @@
 /*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
 /******************************************************************************/
 
+// Standard headers
+#include <type_traits>
+
 // External headers
 #include "gmock/gmock.h"
 
@@ -71,3 +74,51 @@ TEST(ANewGraph, CanBeRandomlyGeneratedWithDefaultSeed) {
 }
 
 /*----------------------------------------------------------------------------*/
+
+TEST(ANewGraph, CanBeRandomlyGeneratedWithIntegralWeights) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(50, 200, 10);
+
+  static_assert(std::is_same<decltype(graph), graph::BasicGraph<int>>::value,
+                "Weights should have the type of the maximum weight");
+
+  for (unsigned int i = 0; i < graph.size(); i++) {
+    for (unsigned int j = 0; j < graph[i].size(); j++) {
+      ASSERT_THAT(graph[i][j].weight, Ge(0));
+      ASSERT_THAT(graph[i][j].weight, Le(10));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ANewGraph, CanBeRandomlyGeneratedWithFloatWeights) {
+  auto graph = graph::generateRandomGraph<std::mt19937, float>(50, 200, 1.5f);
+
+  for (unsigned int i = 0; i < graph.size(); i++) {
+    for (unsigned int j = 0; j < graph[i].size(); j++) {
+      ASSERT_THAT(graph[i][j].weight, Ge(0.0f));
+      ASSERT_THAT(graph[i][j].weight, Le(1.5f));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AGraph, CanBeReversed) {
+  graph::Graph graph(3);
+  graph[0].push_back(graph::Edge{1, 7});
+  graph[0].push_back(graph::Edge{2, 9});
+  graph[2].push_back(graph::Edge{1, 2});
+
+  auto reverse = graph::reverseGraph(graph);
+
+  ASSERT_THAT(reverse.size(), Eq(3u));
+  ASSERT_THAT(reverse[0].size(), Eq(0u));
+  ASSERT_THAT(reverse[1].size(), Eq(2u));
+  ASSERT_THAT(reverse[1][0], Eq(graph::Edge{0, 7}));
+  ASSERT_THAT(reverse[1][1], Eq(graph::Edge{2, 2}));
+  ASSERT_THAT(reverse[2].size(), Eq(1u));
+  ASSERT_THAT(reverse[2][0], Eq(graph::Edge{0, 9}));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,83 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/Graph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Tested header
+#include "graph/Landmarks.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Gt;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(Landmarks, AreSelectedFarFromEachOther) {
+  // Path 0 - 1 - 2 - 3 - 4 in both directions
+  graph::Graph graph(5);
+  for (graph::Key u = 0; u + 1 < 5; u++) {
+    graph[u].push_back(graph::Edge{u+1, 1});
+    graph[u+1].push_back(graph::Edge{u, 1});
+  }
+
+  auto landmarks = graph::buildLandmarks<heap::Binary>(graph, 2);
+
+  ASSERT_THAT(landmarks.nodes(), ElementsAre(4, 0));
+  ASSERT_THAT(landmarks.lower_bound(1, 3), Eq(2));
+  ASSERT_THAT(landmarks.lower_bound(3, 3), Eq(0));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(Landmarks, NeverOverestimateDistances) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(300, 1500, 100u);
+  auto landmarks = graph::buildLandmarks<heap::Binary>(graph, 4);
+
+  ASSERT_THAT(landmarks.size(), Eq(4u));
+
+  graph::Key source = 7;
+  auto d = graph::shortestPathTree<heap::Binary>(graph, source).distance;
+
+  unsigned int total_bound = 0;
+  for (graph::Key v = 0; v < graph.size(); v++) {
+    auto bound = landmarks.lower_bound(source, v);
+    if (d[v] != graph::infinity<unsigned int>()) {
+      ASSERT_THAT(bound, Le(d[v]));
+    }
+    total_bound += bound;
+  }
+  ASSERT_THAT(total_bound, Gt(0u));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,256 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+// System headers
+#include <unistd.h>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/dijkstra.hpp"
+
+// Tested header
+#include "graph/MappedGraph.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct AGraphFile : public ::testing::Test {
+  std::string path;
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100.0);
+
+  AGraphFile() {
+    char name[] = "/tmp/heaps-graph-XXXXXX";
+    int fd = ::mkstemp(name);
+    if (fd >= 0) ::close(fd);
+    path = name;
+  }
+
+  ~AGraphFile() {
+    std::remove(path.c_str());
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(AMappedGraph, CanBeEmptyConstructed) {
+  graph::MappedGraph mapped;
+
+  ASSERT_THAT(mapped.size(), Eq(0u));
+  ASSERT_THAT(mapped.num_edges(), Eq(0u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AMappedGraph, ThrowsWhenFileDoesNotExist) {
+  ASSERT_THROW(graph::MappedGraph("/nonexistent/graph.bin"),
+               std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, KeepsAllEdgesOfSavedGraph) {
+  graph::saveGraph(graph, path);
+  graph::MappedGraph mapped(path);
+
+  ASSERT_THAT(mapped.size(), Eq(graph.size()));
+  ASSERT_THAT(mapped.num_edges(), Eq(5000u));
+
+  for (graph::Key u = 0; u < graph.size(); u++) {
+    ASSERT_THAT(mapped[u].size(), Eq(graph[u].size()));
+    for (unsigned int i = 0; i < graph[u].size(); i++)
+      ASSERT_THAT(mapped[u][i], Eq(graph[u][i]));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, CanBeSavedFromCsrGraphWithFloatWeights) {
+  graph::BasicCsrGraph<float> csr(graph);
+  graph::saveGraph(csr, path);
+  graph::BasicMappedGraph<float> mapped(path);
+
+  ASSERT_THAT(mapped.size(), Eq(csr.size()));
+  for (graph::Key u = 0; u < csr.size(); u++)
+    for (unsigned int i = 0; i < csr[u].size(); i++)
+      ASSERT_THAT(mapped[u][i], Eq(csr[u][i]));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, CanBeUsedToFindMinimumPaths) {
+  graph::saveGraph(graph, path);
+  graph::MappedGraph mapped(path);
+
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto mapped_path = graph::dijkstra<heap::Binary>(mapped, 0, destination);
+    ASSERT_THAT(mapped_path, Eq(path));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, CanBeMovedToOtherMappedGraph) {
+  graph::saveGraph(graph, path);
+  graph::MappedGraph mapped(path);
+  graph::MappedGraph other(std::move(mapped));
+
+  ASSERT_THAT(mapped.size(), Eq(0u));
+  ASSERT_THAT(other.size(), Eq(1000u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenWeightTypeIsDifferent) {
+  graph::saveGraph(graph, path);
+  ASSERT_THROW(graph::BasicMappedGraph<float>{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenFileIsNotAGraph) {
+  std::ofstream(path) << "(1,2.5) (2,3)\n";
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenFileIsTruncated) {
+  graph::saveGraph(graph, path);
+  ASSERT_THAT(::truncate(path.c_str(), 4096), Eq(0));
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenOffsetsDecrease) {
+  graph::saveGraph(graph, path);
+
+  // Offset of vertex 2 becomes bigger than the one of vertex 3
+  std::uint64_t offset = graph.size();
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(sizeof(graph::GraphFileHeader) + 2 * sizeof(offset));
+  file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+  file.close();
+
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenTargetIsNotAVertex) {
+  graph::saveGraph(graph, path);
+
+  graph::GraphFileHeader header;
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  graph::Key target = graph.size();
+  file.seekp(header.targets_position + 10 * sizeof(target));
+  file.write(reinterpret_cast<const char*>(&target), sizeof(target));
+  file.close();
+
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenSectionPositionWrapsAround) {
+  graph::saveGraph(graph, path);
+
+  graph::GraphFileHeader header;
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  // End of the targets would wrap around to 0
+  header.num_nodes = 2;
+  header.num_edges = 1;
+  header.targets_position = std::uint64_t(-1) - 3;
+  std::uint64_t offsets[] = { 0, 0, 1 };
+  file.seekp(0);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(offsets), sizeof(offsets));
+  file.close();
+
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, ThrowsWhenSectionIsMisaligned) {
+  graph::saveGraph(graph, path);
+
+  graph::GraphFileHeader header;
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  // Padding keeps the shifted weights inside the file
+  header.weights_position += 1;
+  file.seekp(0);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.seekp(0, std::ios::end);
+  file.write("\0\0\0\0\0\0\0\0", 8);
+  file.close();
+
+  ASSERT_THROW(graph::MappedGraph{path}, std::runtime_error);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AGraphFile, CanBeConvertedFromTextFormat) {
+  std::string text_path = path + ".txt";
+  {
+    std::ofstream os(text_path);
+    graph::writeGraph(os, graph);
+  }
+
+  graph::convertGraph(text_path, path);
+  std::remove(text_path.c_str());
+
+  graph::MappedGraph mapped(path);
+  ASSERT_THAT(mapped.size(), Eq(graph.size()));
+  for (graph::Key u = 0; u < graph.size(); u++)
+    for (unsigned int i = 0; i < graph[u].size(); i++)
+      ASSERT_THAT(mapped[u][i], Eq(graph[u][i]));
+}
+
+/*----------------------------------------------------------------------------*/
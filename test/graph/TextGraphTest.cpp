@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <string>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "graph/CsrGraph.hpp"
+
+// Tested header
+#include "graph/TextGraph.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, CanBeReadFromStream) {
+  std::istringstream is("(1,7) (2,9.5)\n\n(0,2)\n");
+  auto graph = graph::readGraph(is);
+
+  ASSERT_THAT(graph.size(), Eq(3u));
+  ASSERT_THAT(graph[0], ElementsAre(graph::Edge{1, 7}, graph::Edge{2, 9.5}));
+  ASSERT_THAT(graph[1], IsEmpty());
+  ASSERT_THAT(graph[2], ElementsAre(graph::Edge{0, 2}));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, CanBeReadWithIntegralWeights) {
+  std::istringstream is("(1,7) (2,9)\n(0,2)\n");
+  auto graph = graph::readGraph<int>(is);
+
+  ASSERT_THAT(graph[0], ElementsAre(graph::BasicEdge<int>{1, 7},
+                                    graph::BasicEdge<int>{2, 9}));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ThrowsWhenEdgeIsMalformed) {
+  std::istringstream is("(1,7) (2;9)\n");
+  ASSERT_THROW(graph::readGraph(is), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ThrowsWhenKeyOverflows) {
+  std::istringstream is("(4294967297,1.5)\n");
+  ASSERT_THROW(graph::readGraph(is), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ThrowsWhenIntegralWeightOverflows) {
+  std::istringstream is("(0,2147483648)\n");
+  ASSERT_THROW(graph::readGraph<int>(is), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, CanBeReadWithExtremeIntegralWeights) {
+  std::istringstream is("(0,2147483647) (0,-2147483648)\n");
+  auto graph = graph::readGraph<int>(is);
+
+  ASSERT_THAT(graph[0],
+              ElementsAre(graph::BasicEdge<int>{0, 2147483647},
+                          graph::BasicEdge<int>{0, -2147483647 - 1}));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, CanBeWrittenAndReadBack) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(100, 500, 10.0);
+
+  std::stringstream ss;
+  graph::writeGraph(ss, graph::CsrGraph(graph));
+
+  ASSERT_THAT(graph::readGraph(ss), Eq(graph));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ParsesWeightsAsTheStandardLibrary) {
+  std::string text = "(0,0.1) (0,-2.5e-3) (0,1e22) (0,3.14159265358979)"
+                     " (0,123456789012345678901234) (0,1e-300) (0, 0.000)";
+  auto graph = graph::parseGraph(text.data(), text.data() + text.size());
+
+  std::istringstream is(text);
+  for (const auto& edge : graph[0]) {
+    graph::Edge expected;
+    is >> expected;
+    EXPECT_THAT(edge.weight, Eq(expected.weight));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ReportsLineOfMalformedEdge) {
+  std::string text = std::string(3 << 20, '\n') + "(1,7) (2,)\n";
+
+  try {
+    graph::parseGraph(text.data(), text.data() + text.size(), 4);
+    FAIL() << "Expected std::invalid_argument";
+  } catch (const std::invalid_argument& e) {
+    ASSERT_THAT(std::string(e.what()),
+                Eq("Malformed edge in line " + std::to_string(3 << 20 | 1)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, ParsesTheSameGraphWithManyThreads) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(50000, 500000, 10.0);
+
+  std::ostringstream os;
+  graph::writeGraph(os, graph);
+  auto text = os.str();
+
+  auto first = text.data(), last = text.data() + text.size();
+  ASSERT_THAT(graph::parseGraph(first, last, 8),
+              Eq(graph::parseGraph(first, last, 1)));
+  ASSERT_THAT(graph::parseGraph(first, last, 8), Eq(graph));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ATextGraph, CanBeParsedInCsrFormat) {
+  std::string text = "(1,7) (2,9.5)\n\n(0,2)";
+  auto graph = graph::parseCsrGraph(text.data(), text.data() + text.size());
+
+  ASSERT_THAT(graph.size(), Eq(3u));
+  ASSERT_THAT(graph.num_edges(), Eq(3u));
+  ASSERT_THAT(graph[0][0], Eq(graph::Edge{1, 7}));
+  ASSERT_THAT(graph[0][1], Eq(graph::Edge{2, 9.5}));
+  ASSERT_THAT(graph[1].empty(), Eq(true));
+  ASSERT_THAT(graph[2][0], Eq(graph::Edge{0, 2}));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,170 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+#include <algorithm>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Radix.hpp"
+#include "heap/Binary.hpp"
+#include "heap/Pairing.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/Landmarks.hpp"
+
+// Tested header
+#include "graph/astar.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::DoubleEq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ADirectedGraph : public ::testing::Test {
+  graph::Graph graph;
+
+  ADirectedGraph() : graph(6) {
+    graph[0].push_back(graph::Edge{1, 7});   // edge 0->1 weight = 7
+    graph[0].push_back(graph::Edge{2, 9});   // edge 0->2 weight = 9
+    graph[0].push_back(graph::Edge{5, 14});  // edge 0->5 weight = 14
+    graph[1].push_back(graph::Edge{2, 10});  // edge 1->2 weight = 10
+    graph[1].push_back(graph::Edge{3, 15});  // edge 1->3 weight = 15
+    graph[2].push_back(graph::Edge{5, 2});   // edge 2->5 weight = 2
+    graph[2].push_back(graph::Edge{3, 11});  // edge 2->3 weight = 11
+    graph[3].push_back(graph::Edge{4, 6});   // edge 3->4 weight = 6
+    graph[4].push_back(graph::Edge{5, 9});   // edge 4->5 weight = 9
+  }
+};
+
+struct ARandomGraph : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100.0);
+
+  graph::Weight cost(const std::vector<graph::Key>& path) const {
+    graph::Weight total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::Infinity;
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ARandomGraphWithIntegralWeights, FindsPathsWithLandmarksAndRadixHeap) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100u);
+  auto landmarks = graph::buildLandmarks<heap::Radix>(graph, 8);
+
+  auto cost = [&graph](const std::vector<graph::Key>& path) {
+    unsigned int total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::infinity<unsigned int>();
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  };
+
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto dijkstra_path = graph::dijkstra<heap::Radix>(graph, 0, destination);
+    auto astar_path = graph::astar<heap::Radix>(
+      graph, 0, destination, landmarks.heuristic(destination));
+    ASSERT_THAT(cost(astar_path), Eq(cost(dijkstra_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenUnconnectedNodesWithoutHeuristic) {
+  auto minimum_path = graph::astar<heap::Binary>(
+    graph, 5, 0, [](graph::Key) { return 0.0; });
+  ASSERT_THAT(minimum_path, ElementsAre(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenSameNodeWithoutHeuristic) {
+  auto minimum_path = graph::astar<heap::Binary>(
+    graph, 0, 0, [](graph::Key) { return 0.0; });
+  ASSERT_THAT(minimum_path, ElementsAre(0));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithoutHeuristic) {
+  auto minimum_path = graph::astar<heap::Binary>(
+    graph, 0, 4, [](graph::Key) { return 0.0; });
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithExactDistancesAsHeuristic) {
+  std::vector<graph::Weight> distance_to_4 = { 26, 21, 17, 6, 0, 1000 };
+  auto minimum_path = graph::astar<heap::Pairing>(
+    graph, 0, 4, [&](graph::Key u) { return distance_to_4[u]; });
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithLandmarks) {
+  auto landmarks = graph::buildLandmarks<heap::Binary>(graph, 2);
+  auto minimum_path = graph::astar<heap::Binary>(
+    graph, 0, 4, landmarks.heuristic(4));
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostAsDijkstraUsingLandmarks) {
+  auto landmarks = graph::buildLandmarks<heap::Binary>(graph, 8);
+  graph::CsrGraph csr(graph);
+
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto dijkstra_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto astar_path = graph::astar<heap::Binary>(
+      graph, 0, destination, landmarks.heuristic(destination));
+    auto csr_path = graph::astar<heap::Pairing>(
+      csr, 0, destination, landmarks.heuristic(destination));
+    ASSERT_THAT(cost(astar_path), DoubleEq(cost(dijkstra_path)));
+    ASSERT_THAT(cost(csr_path), DoubleEq(cost(dijkstra_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
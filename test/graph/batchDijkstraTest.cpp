@@ -0,0 +1,146 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+#include <utility>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "heap/Pairing.hpp"
+#include "graph/dijkstra.hpp"
+
+// Tested header
+#include "graph/batchDijkstra.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ADirectedGraph : public ::testing::Test {
+  graph::Graph graph;
+
+  ADirectedGraph() : graph(6) {
+    graph[0].push_back(graph::Edge{1, 7});   // edge 0->1 weight = 7
+    graph[0].push_back(graph::Edge{2, 9});   // edge 0->2 weight = 9
+    graph[0].push_back(graph::Edge{5, 14});  // edge 0->5 weight = 14
+    graph[1].push_back(graph::Edge{2, 10});  // edge 1->2 weight = 10
+    graph[1].push_back(graph::Edge{3, 15});  // edge 1->3 weight = 15
+    graph[2].push_back(graph::Edge{5, 2});   // edge 2->5 weight = 2
+    graph[2].push_back(graph::Edge{3, 11});  // edge 2->3 weight = 11
+    graph[3].push_back(graph::Edge{4, 6});   // edge 3->4 weight = 6
+    graph[4].push_back(graph::Edge{5, 9});   // edge 4->5 weight = 9
+  }
+};
+
+struct ABatchOfRandomQueries : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100.0);
+  std::vector<std::pair<graph::Key, graph::Key>> queries;
+
+  ABatchOfRandomQueries() {
+    // Few sources, so that many queries share the same search
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<graph::Key> source(0, 19);
+    std::uniform_int_distribution<graph::Key> node(0, 999);
+    for (unsigned int i = 0; i < 200; i++)
+      queries.emplace_back(source(generator), node(generator));
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(AnEmptyBatch, HasNoPaths) {
+  graph::Graph graph(3);
+  auto paths = graph::batchDijkstra<heap::Binary>(graph, {});
+  ASSERT_THAT(paths, IsEmpty());
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathsOfABatchInInputOrder) {
+  auto paths = graph::batchDijkstra<heap::Binary>(
+    graph, { {0, 4}, {1, 5}, {0, 3}, {0, 4}, {3, 3} });
+
+  ASSERT_THAT(paths.size(), Eq(5u));
+  ASSERT_THAT(paths[0], ElementsAre(0, 2, 3, 4));
+  ASSERT_THAT(paths[1], ElementsAre(1, 2, 5));
+  ASSERT_THAT(paths[2], ElementsAre(0, 2, 3));
+  ASSERT_THAT(paths[3], ElementsAre(0, 2, 3, 4));
+  ASSERT_THAT(paths[4], ElementsAre(3));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathsOfABatchWithUnconnectedNodes) {
+  auto paths = graph::batchDijkstra<heap::Binary>(
+    graph, { {5, 0}, {5, 5}, {4, 5} });
+
+  ASSERT_THAT(paths.size(), Eq(3u));
+  ASSERT_THAT(paths[0], ElementsAre(5));
+  ASSERT_THAT(paths[1], ElementsAre(5));
+  ASSERT_THAT(paths[2], ElementsAre(4, 5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABatchOfRandomQueries, HasSamePathsAsDijkstraWithManyThreads) {
+  for (unsigned int num_threads : { 1u, 2u, 4u }) {
+    auto paths = graph::batchDijkstra<heap::Binary>(
+      graph, queries, num_threads);
+
+    ASSERT_THAT(paths.size(), Eq(queries.size()));
+    for (unsigned int i = 0; i < queries.size(); i++) {
+      auto path = graph::dijkstra<heap::Binary>(
+        graph, queries[i].first, queries[i].second);
+      ASSERT_THAT(paths[i], Eq(path));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABatchOfRandomQueries, HasSamePathsAsDijkstraWithDecreaseKey) {
+  auto paths = graph::batchDijkstra<heap::Pairing, graph::DecreaseKey>(
+    graph, queries, 3);
+
+  ASSERT_THAT(paths.size(), Eq(queries.size()));
+  for (unsigned int i = 0; i < queries.size(); i++) {
+    auto path = graph::dijkstra<heap::Pairing, graph::DecreaseKey>(
+      graph, queries[i].first, queries[i].second);
+    ASSERT_THAT(paths[i], Eq(path));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
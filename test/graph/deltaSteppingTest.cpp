@@ -0,0 +1,119 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/Binary.hpp"
+#include "graph/CsrGraph.hpp"
+#include "graph/dijkstra.hpp"
+
+// Tested header
+#include "graph/deltaStepping.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ADirectedGraph : public ::testing::Test {
+  graph::Graph graph;
+
+  ADirectedGraph() : graph(6) {
+    graph[0].push_back(graph::Edge{1, 7});   // edge 0->1 weight = 7
+    graph[0].push_back(graph::Edge{2, 9});   // edge 0->2 weight = 9
+    graph[0].push_back(graph::Edge{5, 14});  // edge 0->5 weight = 14
+    graph[1].push_back(graph::Edge{2, 10});  // edge 1->2 weight = 10
+    graph[1].push_back(graph::Edge{3, 15});  // edge 1->3 weight = 15
+    graph[2].push_back(graph::Edge{5, 2});   // edge 2->5 weight = 2
+    graph[2].push_back(graph::Edge{3, 11});  // edge 2->3 weight = 11
+    graph[3].push_back(graph::Edge{4, 6});   // edge 3->4 weight = 6
+    graph[4].push_back(graph::Edge{5, 9});   // edge 4->5 weight = 9
+  }
+};
+
+struct ARandomGraphForDeltaStepping : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(2000, 10000, 100.0);
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ARandomGraphWithIntegralWeights, HasSameDistancesAsDijkstra) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(2000, 10000, 100u);
+  auto tree = graph::shortestPathTree<heap::Binary>(graph, 0);
+
+  for (unsigned int delta : { 1u, 25u, 1000u }) {
+    auto distances = graph::deltaStepping(graph, 0, delta, 4);
+    ASSERT_THAT(distances, Eq(tree.distance));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinDistancesWithDeltaStepping) {
+  auto distances = graph::deltaStepping(graph, 0, 5.0, 2);
+  ASSERT_THAT(distances, ElementsAre(0, 7, 9, 20, 26, 11));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, HasInfiniteDistancesToUnreachableNodes) {
+  auto distances = graph::deltaStepping(graph, 3, 5.0, 2);
+  ASSERT_THAT(distances, ElementsAre(graph::Infinity, graph::Infinity,
+                                     graph::Infinity, 0, 6, 15));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraphForDeltaStepping, HasSameDistancesAsDijkstra) {
+  auto tree = graph::shortestPathTree<heap::Binary>(graph, 0);
+
+  for (unsigned int num_threads : { 1u, 2u, 4u }) {
+    for (auto delta : { 0.5, 20.0, 1000.0 }) {
+      auto distances = graph::deltaStepping(graph, 0, delta, num_threads);
+      ASSERT_THAT(distances, Eq(tree.distance));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraphForDeltaStepping, HasSameDistancesAsDijkstraInCsrGraph) {
+  graph::CsrGraph csr_graph(graph);
+  auto tree = graph::shortestPathTree<heap::Binary>(csr_graph, 42);
+  auto distances = graph::deltaStepping(csr_graph, 42, 20.0, 3);
+  ASSERT_THAT(distances, Eq(tree.distance));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -20,7 +20,10 @@
 #include "gmock/gmock.h"
 
 // Internal headers
+#include "heap/DAry.hpp"
+#include "heap/Radix.hpp"
 #include "heap/Binary.hpp"
+#include "heap/Pairing.hpp"
 #include "heap/Fibonacci.hpp"
 
 // Tested header
@@ -31,6 +34,7 @@
 /*----------------------------------------------------------------------------*/
 
 using ::testing::Eq;
+using ::testing::DoubleEq;
 using ::testing::ElementsAre;
 
 /*----------------------------------------------------------------------------*/
@@ -99,10 +103,51 @@ struct AnUndirectedGraph : public ::testing::Test {
   }
 };
 
+struct ARandomGraph : public ::testing::Test {
+  graph::Graph graph
+    = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100.0);
+
+  graph::Weight cost(const std::vector<graph::Key>& path) const {
+    graph::Weight total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::Infinity;
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  }
+};
+
 /*----------------------------------------------------------------------------*/
 /*                                SIMPLE TESTS                                */
 /*----------------------------------------------------------------------------*/
 
+TEST(ARandomGraphWithIntegralWeights, FindsPathsWithSameCostUsingAllHeaps) {
+  auto graph = graph::generateRandomGraph<std::mt19937>(1000, 5000, 100u);
+
+  auto cost = [&graph](const std::vector<graph::Key>& path) {
+    unsigned int total = 0;
+    for (unsigned int i = 1; i < path.size(); i++) {
+      auto weight = graph::infinity<unsigned int>();
+      for (const auto& edge : graph[path[i-1]])
+        if (edge.key == path[i]) weight = std::min(weight, edge.weight);
+      total += weight;
+    }
+    return total;
+  };
+
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto radix_path = graph::dijkstra<heap::Radix>(graph, 0, destination);
+    auto fibonacci_path
+      = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(
+          graph, 0, destination);
+    ASSERT_THAT(cost(radix_path), Eq(cost(binary_path)));
+    ASSERT_THAT(cost(fibonacci_path), Eq(cost(binary_path)));
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*                             TESTS WITH FIXTURE                             */
 /*----------------------------------------------------------------------------*/
@@ -161,6 +206,13 @@ TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithFibonacciHeap) {
 
 /*----------------------------------------------------------------------------*/
 
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithArenaFibHeap) {
+  auto minimum_path = graph::dijkstra<heap::ArenaFibonacci>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
 TEST_F(AnUndirectedGraph, CanFindMinPathBetweenSameNodeWithBinaryHeap) {
   auto minimum_path = graph::dijkstra<heap::Binary>(graph, 0, 0);
   ASSERT_THAT(minimum_path, ElementsAre(0));
@@ -188,3 +240,374 @@ TEST_F(AnUndirectedGraph, CanFindMinPathBetweenDistinctNodesWithFibonacciHeap) {
 }
 
 /*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathBetweenDistinctNodesWithArenaFibHeap) {
+  auto minimum_path = graph::dijkstra<heap::ArenaFibonacci>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithBinaryHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::Binary, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithFibonacciHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathWithBinaryHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::Binary, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathWithFibonacciHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithDAry4Heap) {
+  auto minimum_path = graph::dijkstra<heap::DAry4>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithDAry4HeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::DAry4, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathBetweenDistinctNodesWithDAry4Heap) {
+  auto minimum_path = graph::dijkstra<heap::DAry4>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathWithDAry4HeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::DAry4, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostUsingBothStrategies) {
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto lazy_path
+      = graph::dijkstra<heap::Binary, graph::LazyInsertion>(
+          graph, 0, destination);
+    auto decrease_key_path
+      = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(
+          graph, 0, destination);
+    ASSERT_THAT(cost(decrease_key_path), DoubleEq(cost(lazy_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostUsingDAryHeaps) {
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto dary4_path
+      = graph::dijkstra<heap::DAry4, graph::DecreaseKey>(
+          graph, 0, destination);
+    auto dary8_path = graph::dijkstra<heap::DAry8>(graph, 0, destination);
+    ASSERT_THAT(cost(dary4_path), DoubleEq(cost(binary_path)));
+    ASSERT_THAT(cost(dary8_path), DoubleEq(cost(binary_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostUsingValueBinaryHeap) {
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto value_path = graph::dijkstra<heap::ValueBinary>(graph, 0, destination);
+    ASSERT_THAT(cost(value_path), DoubleEq(cost(binary_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithPairingHeap) {
+  auto minimum_path = graph::dijkstra<heap::Pairing>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithPairingHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::Pairing, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathWithArenaPairingHeapAndDecreaseKey) {
+  auto minimum_path
+    = graph::dijkstra<heap::ArenaPairing, graph::DecreaseKey>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostUsingPairingHeaps) {
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto lazy_path = graph::dijkstra<heap::Pairing>(graph, 0, destination);
+    auto decrease_key_path
+      = graph::dijkstra<heap::Pairing, graph::DecreaseKey>(
+          graph, 0, destination);
+    ASSERT_THAT(cost(lazy_path), DoubleEq(cost(binary_path)));
+    ASSERT_THAT(cost(decrease_key_path), DoubleEq(cost(binary_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesWithRadixHeap) {
+  auto minimum_path = graph::dijkstra<heap::Radix>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathBetweenDistinctNodesWithRadixHeap) {
+  auto minimum_path = graph::dijkstra<heap::Radix>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostUsingRadixHeap) {
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto radix_path = graph::dijkstra<heap::Radix>(graph, 0, destination);
+    ASSERT_THAT(cost(radix_path), DoubleEq(cost(binary_path)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathInCsrGraphWithBinaryHeap) {
+  graph::CsrGraph csr(graph);
+  auto minimum_path = graph::dijkstra<heap::Binary>(csr, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathInCsrGraphWithFibonacciHeap) {
+  graph::CsrGraph csr(graph);
+  auto minimum_path
+    = graph::dijkstra<heap::Fibonacci, graph::DecreaseKey>(csr, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsSamePathsInCsrGraph) {
+  graph::CsrGraph csr(graph);
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto csr_path = graph::dijkstra<heap::Binary>(csr, 0, destination);
+    ASSERT_THAT(csr_path, Eq(path));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathWithIntegralWeights) {
+  graph::BasicCsrGraph<int> csr(graph);
+  auto minimum_path = graph::dijkstra<heap::Radix>(csr, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathWithFloatWeights) {
+  graph::BasicCsrGraph<float> csr(graph);
+  auto minimum_path
+    = graph::dijkstra<heap::Binary, graph::DecreaseKey>(csr, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenUnconnectedNodesBidirectionally) {
+  auto minimum_path = graph::bidirectionalDijkstra<heap::Binary>(graph, 5, 0);
+  ASSERT_THAT(minimum_path, ElementsAre(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenSameNodeBidirectionally) {
+  auto minimum_path = graph::bidirectionalDijkstra<heap::Binary>(graph, 0, 0);
+  ASSERT_THAT(minimum_path, ElementsAre(0));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathBetweenDistinctNodesBidirectionally) {
+  auto minimum_path = graph::bidirectionalDijkstra<heap::Binary>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AnUndirectedGraph, CanFindMinPathBetweenDistinctNodesBidirectionally) {
+  auto minimum_path
+    = graph::bidirectionalDijkstra<heap::Pairing>(graph, 0, 4);
+  ASSERT_THAT(minimum_path, ElementsAre(0, 2, 5, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostBidirectionally) {
+  graph::CsrGraph csr(graph);
+  graph::CsrGraph reverse(graph::reverseGraph(graph));
+
+  for (graph::Key destination = 1; destination < 50; destination++) {
+    auto binary_path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    auto bidirectional_path
+      = graph::bidirectionalDijkstra<heap::Binary>(graph, 0, destination);
+    auto csr_path
+      = graph::bidirectionalDijkstra<heap::Radix>(csr, reverse,
+                                                  0, destination);
+    ASSERT_THAT(cost(bidirectional_path), DoubleEq(cost(binary_path)));
+    ASSERT_THAT(cost(csr_path), DoubleEq(cost(binary_path)));
+    ASSERT_THAT(bidirectional_path.front(), Eq(binary_path.front()));
+    ASSERT_THAT(bidirectional_path.back(), Eq(binary_path.back()));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, HasShortestPathTreeWithAllDistances) {
+  auto tree = graph::shortestPathTree<heap::Binary>(graph, 0);
+
+  ASSERT_THAT(tree.source, Eq(0u));
+  ASSERT_THAT(tree.distance, ElementsAre(0, 7, 9, 20, 26, 11));
+  ASSERT_THAT(tree.parent, ElementsAre(graph::InvalidKey, 0, 0, 2, 3, 2));
+  ASSERT_THAT(tree.path_to(4), ElementsAre(0, 2, 3, 4));
+  ASSERT_THAT(tree.path_to(0), ElementsAre(0));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, HasShortestPathTreeWithUnreachableNodes) {
+  auto tree
+    = graph::shortestPathTree<heap::Fibonacci, graph::DecreaseKey>(graph, 3);
+
+  ASSERT_THAT(tree.reaches(5), Eq(true));
+  ASSERT_THAT(tree.reaches(0), Eq(false));
+  ASSERT_THAT(tree.path_to(0), ElementsAre(3));
+  ASSERT_THAT(tree.path_to(5), ElementsAre(3, 4, 5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanStoreShortestPathTreeInCallerBuffers) {
+  std::vector<graph::Weight> d;
+  std::vector<graph::Key> parent;
+
+  graph::shortestPathTree<heap::Binary>(graph, 0, d, parent);
+  auto distances = d.data();
+  auto parents = parent.data();
+
+  graph::shortestPathTree<heap::Binary>(graph, 2, d, parent);
+
+  ASSERT_THAT(d.data(), Eq(distances));
+  ASSERT_THAT(parent.data(), Eq(parents));
+  ASSERT_THAT(d[0], Eq(graph::Infinity));
+  ASSERT_THAT(d[4], Eq(17));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, HasShortestPathTreeWithSamePathsAsDijkstra) {
+  auto tree = graph::shortestPathTree<heap::Pairing>(graph::CsrGraph(graph),
+                                                     0);
+
+  for (graph::Key destination = 1; destination < 1000; destination++) {
+    auto path = graph::dijkstra<heap::Binary>(graph, 0, destination);
+    ASSERT_THAT(cost(tree.path_to(destination)), DoubleEq(cost(path)));
+    if (tree.reaches(destination)) {
+      ASSERT_THAT(tree.distance[destination], DoubleEq(cost(path)));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, CanFindMinPathsReusingWorkspace) {
+  graph::DijkstraWorkspace<heap::Binary> workspace;
+
+  ASSERT_THAT(graph::dijkstra(graph, 0, 4, workspace),
+              ElementsAre(0, 2, 3, 4));
+  ASSERT_THAT(graph::dijkstra(graph, 5, 0, workspace), ElementsAre(5));
+  ASSERT_THAT(graph::dijkstra(graph, 1, 5, workspace),
+              ElementsAre(1, 2, 5));
+  ASSERT_THAT(workspace.distance(5), Eq(12));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADirectedGraph, ResetsOnlyNodesTouchedByLastSearch) {
+  graph::DijkstraWorkspace<heap::Fibonacci, graph::DecreaseKey> workspace;
+
+  workspace.search(graph, 0);
+  ASSERT_THAT(workspace.touched_nodes().size(), Eq(6u));
+
+  workspace.search(graph, 3);
+  ASSERT_THAT(workspace.touched_nodes(), ElementsAre(3, 4, 5));
+  ASSERT_THAT(workspace.distances(),
+              ElementsAre(graph::Infinity, graph::Infinity, graph::Infinity,
+                          0, 6, 15));
+  ASSERT_THAT(workspace.parents(),
+              ElementsAre(graph::InvalidKey, graph::InvalidKey,
+                          graph::InvalidKey, graph::InvalidKey, 3, 4));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARandomGraph, FindsPathsWithSameCostReusingWorkspace) {
+  graph::CsrGraph csr(graph);
+  graph::DijkstraWorkspace<heap::Binary> binary_workspace;
+  graph::DijkstraWorkspace<heap::Pairing, graph::DecreaseKey>
+    pairing_workspace(csr.size());
+
+  for (graph::Key source = 0; source < 1000; source += 97) {
+    for (graph::Key destination = 1; destination < 50; destination++) {
+      auto path = graph::dijkstra<heap::Binary>(graph, source, destination);
+      auto binary_path
+        = graph::dijkstra(graph, source, destination, binary_workspace);
+      auto pairing_path
+        = graph::dijkstra(csr, source, destination, pairing_workspace);
+      ASSERT_THAT(cost(binary_path), DoubleEq(cost(path)));
+      ASSERT_THAT(cost(pairing_path), DoubleEq(cost(path)));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
@@ -16,6 +16,12 @@
 /*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
 /******************************************************************************/
 
+// Standard headers
+#include <vector>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
 // External headers
 #include "gmock/gmock.h"
 
@@ -24,12 +30,14 @@
 
 // Aliases
 using BinaryHeap = heap::Binary<int>;
+using ValueBinaryHeap = heap::ValueBinary<int>;
 
 /*----------------------------------------------------------------------------*/
 /*                             USING DECLARATIONS                             */
 /*----------------------------------------------------------------------------*/
 
 using ::testing::Eq;
+using ::testing::ElementsAre;
 
 /*----------------------------------------------------------------------------*/
 /*                                  FIXTURES                                  */
@@ -41,6 +49,12 @@ struct ABinaryHeap : public ::testing::Test {
   // Final heap: (03) (05) (08) (13) (21) (34) (55)
 };
 
+struct AValueBinaryHeap : public ::testing::Test {
+  ValueBinaryHeap bin { 3, 5, 8, 13, 21, 34, 55 };
+
+  // Final heap: (03) (05) (08) (13) (21) (34) (55)
+};
+
 struct AReorganizedBinaryHeap : public ::testing::Test {
   BinaryHeap bin;
   BinaryHeap::node_ptr node03, node05, node08, node13,
@@ -88,6 +102,69 @@ TEST(BinaryHeap, CanBeConstructedWithOneElement) {
   ASSERT_THAT(bin.to_string(), Eq("01"));
 }
 
+TEST(ValueBinaryHeap, CanBeEmptyConstructed) {
+  ValueBinaryHeap bin;
+
+  ASSERT_THAT(bin.size(), Eq(0u));
+  ASSERT_THAT(bin.empty(), Eq(true));
+  ASSERT_THAT(bin.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ValueBinaryHeap, CanBeConstructedWithOneElement) {
+  ValueBinaryHeap bin {1};
+
+  ASSERT_THAT(bin.size(), Eq(1u));
+  ASSERT_THAT(bin.empty(), Eq(false));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+  ASSERT_THAT(bin.to_string(), Eq("01"));
+}
+
+TEST(BinaryHeap, CanBeConstructedFromIterators) {
+  std::vector<int> keys { 55, 34, 21, 13, 8, 5, 3 };
+  BinaryHeap bin(keys.begin(), keys.end());
+
+  ASSERT_THAT(bin.size(), Eq(7u));
+  ASSERT_THAT(bin.find_minimum(), Eq(3));
+  ASSERT_THAT(bin.to_string(), Eq("03 08 05 13 34 55 21"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(BinaryHeap, CanBeConstructedFromRange) {
+  std::vector<int> keys { 55, 34, 21, 13, 8, 5, 3 };
+  BinaryHeap bin(keys);
+
+  ASSERT_THAT(bin.size(), Eq(7u));
+  ASSERT_THAT(bin.find_minimum(), Eq(3));
+  ASSERT_THAT(bin.to_string(), Eq("03 08 05 13 34 55 21"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ValueBinaryHeap, CanBeConstructedFromRange) {
+  std::vector<int> keys { 55, 34, 21, 13, 8, 5, 3 };
+  ValueBinaryHeap bin(keys);
+
+  ASSERT_THAT(bin.size(), Eq(7u));
+  ASSERT_THAT(bin.find_minimum(), Eq(3));
+  ASSERT_THAT(bin.to_string(), Eq("03 08 05 13 34 55 21"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ValueBinaryHeap, CanBeConstructedFromInputIterators) {
+  std::istringstream input("21 8 13 3 5");
+  std::istream_iterator<int> first(input), last;
+  ValueBinaryHeap bin(first, last);
+
+  std::vector<int> keys;
+  while (!bin.empty()) keys.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(3, 5, 8, 13, 21));
+}
+
 /*----------------------------------------------------------------------------*/
 /*                             TESTS WITH FIXTURE                             */
 /*----------------------------------------------------------------------------*/
@@ -184,6 +261,27 @@ TEST_F(AReorganizedBinaryHeap, CanDecreaseKeyChangingMinimum) {
 
 /*----------------------------------------------------------------------------*/
 
+TEST_F(AReorganizedBinaryHeap, CanDecreaseKeyOfInnerNode) {
+  bin.decrease_key(node42, 7);
+
+  ASSERT_THAT(bin.size(), Eq(9u));
+  ASSERT_THAT(bin.find_minimum(), Eq(5));
+  ASSERT_THAT(bin.to_string(), Eq("05 07 08 13 21 34 55 88 72"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedBinaryHeap, CanDecreaseKeyOfSameNodeTwice) {
+  bin.decrease_key(node72, 6);
+  bin.decrease_key(node72, 1);
+
+  ASSERT_THAT(bin.size(), Eq(9u));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+  ASSERT_THAT(bin.to_string(), Eq("01 05 08 13 21 34 55 88 42"));
+}
+
+/*----------------------------------------------------------------------------*/
+
 TEST_F(AReorganizedBinaryHeap, CanRemoveMinimum) {
   bin.remove(node05);
 
@@ -203,3 +301,181 @@ TEST_F(AReorganizedBinaryHeap, CanRemoveNonMinimumRootNode) {
 }
 
 /*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedBinaryHeap, CanRemoveInnerNode) {
+  bin.remove(node21);
+
+  ASSERT_THAT(bin.size(), Eq(8u));
+  ASSERT_THAT(bin.find_minimum(), Eq(5));
+  ASSERT_THAT(bin.to_string(), Eq("05 13 08 42 72 34 55 88"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedBinaryHeap, CanRemoveAllNodesInOrder) {
+  std::vector<int> keys;
+  while (!bin.empty()) keys.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(5, 8, 13, 21, 34, 42, 55, 72, 88));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanInsertANewNode) {
+  bin.insert(1);
+
+  ASSERT_THAT(bin.size(), Eq(8u));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+  ASSERT_THAT(bin.to_string(), Eq("01 03 08 05 21 34 55 13"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanBeMergedWithCopiedBinaryHeap) {
+  ValueBinaryHeap oh {1};
+  bin.merge(oh);
+
+  ASSERT_THAT(bin.size(), Eq(8u));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+  ASSERT_THAT(bin.to_string(), Eq("01 03 08 05 21 34 55 13"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanBeMergedWithMovedBinaryHeap) {
+  ValueBinaryHeap oh {1};
+  bin.merge(std::move(oh));
+
+  ASSERT_THAT(bin.size(), Eq(8u));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+  ASSERT_THAT(bin.to_string(), Eq("01 03 08 05 21 34 55 13"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanDeleteMinimumElement) {
+  auto deleted_key = bin.delete_minimum();
+
+  ASSERT_THAT(deleted_key, Eq(3));
+
+  ASSERT_THAT(bin.size(), Eq(6u));
+  ASSERT_THAT(bin.find_minimum(), Eq(5));
+  ASSERT_THAT(bin.to_string(), Eq("05 13 08 55 21 34"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanDeleteAllElementsInOrder) {
+  bin.insert(4);
+  bin.insert(1);
+
+  std::vector<int> keys;
+  while (!bin.empty()) keys.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(1, 3, 4, 5, 8, 13, 21, 34, 55));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABinaryHeap, CanInsertFewNodesInBulk) {
+  std::vector<int> keys { 2, 40 };
+  bin.insert_bulk(keys.begin(), keys.end());
+
+  ASSERT_THAT(bin.size(), Eq(9u));
+  ASSERT_THAT(bin.find_minimum(), Eq(2));
+  ASSERT_THAT(bin.to_string(), Eq("02 03 08 05 21 34 55 13 40"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABinaryHeap, CanInsertManyNodesInBulk) {
+  std::vector<int> keys;
+  for (int key = 100; key > 0; key--) keys.push_back(key);
+  bin.insert_bulk(keys.begin(), keys.end());
+
+  std::vector<int> deleted;
+  while (!bin.empty()) deleted.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(deleted.size(), Eq(107u));
+  ASSERT_THAT(std::is_sorted(deleted.begin(), deleted.end()), Eq(true));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABinaryHeap, KeepsHandlesValidAfterBulkInsertion) {
+  std::vector<int> keys;
+  for (int key = 100; key > 50; key--) keys.push_back(key);
+  bin.insert_bulk(keys.begin(), keys.end());
+
+  for (auto node : bin.nodes()) {
+    if (node->key == 77) {
+      bin.decrease_key(node, 1);
+      break;
+    }
+  }
+
+  ASSERT_THAT(bin.size(), Eq(57u));
+  ASSERT_THAT(bin.find_minimum(), Eq(1));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABinaryHeap, CanBeMergedWithBiggerBinaryHeap) {
+  std::vector<int> keys;
+  for (int key = 100; key > 0; key--) keys.push_back(key);
+  BinaryHeap oh(keys);
+  bin.merge(std::move(oh));
+
+  std::vector<int> deleted;
+  while (!bin.empty()) deleted.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(deleted.size(), Eq(107u));
+  ASSERT_THAT(std::is_sorted(deleted.begin(), deleted.end()), Eq(true));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanInsertFewKeysInBulk) {
+  std::vector<int> keys { 2, 40 };
+  bin.insert_bulk(keys.begin(), keys.end());
+
+  ASSERT_THAT(bin.size(), Eq(9u));
+  ASSERT_THAT(bin.find_minimum(), Eq(2));
+  ASSERT_THAT(bin.to_string(), Eq("02 03 08 05 21 34 55 13 40"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanInsertManyKeysInBulk) {
+  std::vector<int> keys;
+  for (int key = 100; key > 0; key--) keys.push_back(key);
+  bin.insert_bulk(keys.begin(), keys.end());
+
+  std::vector<int> deleted;
+  while (!bin.empty()) deleted.push_back(bin.delete_minimum());
+
+  ASSERT_THAT(deleted.size(), Eq(107u));
+  ASSERT_THAT(std::is_sorted(deleted.begin(), deleted.end()), Eq(true));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ABinaryHeap, CanBeCleared) {
+  bin.clear();
+
+  ASSERT_THAT(bin.size(), Eq(0u));
+  ASSERT_THAT(bin.empty(), Eq(true));
+  ASSERT_THAT(bin.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AValueBinaryHeap, CanBeCleared) {
+  bin.clear();
+  bin.insert(42);
+
+  ASSERT_THAT(bin.size(), Eq(1u));
+  ASSERT_THAT(bin.find_minimum(), Eq(42));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,261 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "heap/DAry.hpp"
+
+// Aliases
+using DAryHeap = heap::DAry4<int>;
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ADAryHeap : public ::testing::Test {
+  DAryHeap dary { 3, 5, 8, 13, 21, 34, 55 };
+
+  // Final heap: 03 05 08 13 21 34 55
+};
+
+struct AReorganizedDAryHeap : public ::testing::Test {
+  DAryHeap dary;
+  DAryHeap::node_ptr node03, node05, node08, node13,
+                     node21, node34, node55, node42,
+                     node72, node88;
+
+  AReorganizedDAryHeap() : dary() {
+    node03 = dary.insert(3);
+    node05 = dary.insert(5);
+    node08 = dary.insert(8);
+    node13 = dary.insert(13);
+    node21 = dary.insert(21);
+    node34 = dary.insert(34);
+    node55 = dary.insert(55);
+    node42 = dary.insert(42);
+    node72 = dary.insert(72);
+    node88 = dary.insert(88);
+    dary.delete_minimum();  // To reorganize heap
+  }
+
+  // Final heap: 05 34 08 13 21 88 55 42 72
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(DAryHeap, CanBeEmptyConstructed) {
+  DAryHeap dary;
+
+  ASSERT_THAT(dary.size(), Eq(0u));
+  ASSERT_THAT(dary.empty(), Eq(true));
+  ASSERT_THAT(dary.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(DAryHeap, CanBeConstructedWithOneElement) {
+  DAryHeap dary {1};
+
+  ASSERT_THAT(dary.size(), Eq(1u));
+  ASSERT_THAT(dary.empty(), Eq(false));
+  ASSERT_THAT(dary.find_minimum(), Eq(1));
+  ASSERT_THAT(dary.to_string(), Eq("01"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(DAryHeap, CanBeConstructedWithUnorderedElements) {
+  DAryHeap dary { 55, 34, 21, 13, 8, 5, 3 };
+
+  ASSERT_THAT(dary.size(), Eq(7u));
+  ASSERT_THAT(dary.find_minimum(), Eq(3));
+  ASSERT_THAT(dary.to_string(), Eq("03 05 21 13 08 55 34"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(DAryHeap, CanHaveTwoChildrenPerNode) {
+  heap::DAry<int, std::less<int>, 2> dary { 55, 34, 21, 13, 8, 5, 3 };
+
+  ASSERT_THAT(dary.size(), Eq(7u));
+  ASSERT_THAT(dary.find_minimum(), Eq(3));
+  ASSERT_THAT(dary.to_string(), Eq("03 08 05 13 34 55 21"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(DAryHeap, CanHaveEightChildrenPerNode) {
+  heap::DAry8<int> dary { 55, 34, 21, 13, 8, 5, 3, 2, 1, 0 };
+
+  std::vector<int> keys;
+  while (!dary.empty()) keys.push_back(dary.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(0, 1, 2, 3, 5, 8, 13, 21, 34, 55));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanInsertANewNode) {
+  dary.insert(1);
+
+  ASSERT_THAT(dary.size(), Eq(8u));
+  ASSERT_THAT(dary.find_minimum(), Eq(1));
+  ASSERT_THAT(dary.to_string(), Eq("01 03 08 13 21 34 55 05"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanBeMergedWithCopiedDAryHeap) {
+  DAryHeap oh {1};
+  dary.merge(oh);
+
+  ASSERT_THAT(dary.size(), Eq(8u));
+  ASSERT_THAT(dary.find_minimum(), Eq(1));
+  ASSERT_THAT(dary.to_string(), Eq("01 03 08 13 21 34 55 05"));
+  ASSERT_THAT(oh.size(), Eq(1u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanBeMergedWithMovedDAryHeap) {
+  DAryHeap oh {1};
+  dary.merge(std::move(oh));
+
+  ASSERT_THAT(dary.size(), Eq(8u));
+  ASSERT_THAT(dary.find_minimum(), Eq(1));
+  ASSERT_THAT(dary.to_string(), Eq("01 03 08 13 21 34 55 05"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanBeMergedWithItself) {
+  dary.merge(dary);
+
+  ASSERT_THAT(dary.size(), Eq(14u));
+  ASSERT_THAT(dary.delete_minimum(), Eq(3));
+  ASSERT_THAT(dary.delete_minimum(), Eq(3));
+  ASSERT_THAT(dary.delete_minimum(), Eq(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanDeleteMinimumElement) {
+  auto deleted_key = dary.delete_minimum();
+
+  ASSERT_THAT(deleted_key, Eq(3));
+
+  ASSERT_THAT(dary.size(), Eq(6u));
+  ASSERT_THAT(dary.find_minimum(), Eq(5));
+  ASSERT_THAT(dary.to_string(), Eq("05 34 08 13 21 55"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ADAryHeap, CanBeCleared) {
+  dary.clear();
+
+  ASSERT_THAT(dary.size(), Eq(0u));
+  ASSERT_THAT(dary.empty(), Eq(true));
+  ASSERT_THAT(dary.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, CanDecreaseKeyOfMinimum) {
+  dary.decrease_key(node05, 2);
+
+  ASSERT_THAT(dary.size(), Eq(9u));
+  ASSERT_THAT(dary.find_minimum(), Eq(2));
+  ASSERT_THAT(dary.to_string(), Eq("02 34 08 13 21 88 55 42 72"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, CanDecreaseKeyOfNonMinimumNode) {
+  dary.decrease_key(node88, 7);
+
+  ASSERT_THAT(dary.size(), Eq(9u));
+  ASSERT_THAT(dary.find_minimum(), Eq(5));
+  ASSERT_THAT(dary.to_string(), Eq("05 07 08 13 21 34 55 42 72"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, ThrowsWhenNodeKeyIsBiggerThanCurrentKey) {
+  ASSERT_THROW(dary.decrease_key(node88, 90), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, CanDecreaseKeyChangingMinimum) {
+  dary.decrease_key(node88, 0);
+
+  ASSERT_THAT(dary.size(), Eq(9u));
+  ASSERT_THAT(dary.find_minimum(), Eq(0));
+  ASSERT_THAT(dary.to_string(), Eq("00 05 08 13 21 34 55 42 72"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, CanRemoveMinimum) {
+  dary.remove(node05);
+
+  ASSERT_THAT(dary.size(), Eq(8u));
+  ASSERT_THAT(dary.find_minimum(), Eq(8));
+  ASSERT_THAT(dary.to_string(), Eq("08 34 72 13 21 88 55 42"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, CanRemoveNonMinimumNode) {
+  dary.remove(node88);
+
+  ASSERT_THAT(dary.size(), Eq(8u));
+  ASSERT_THAT(dary.find_minimum(), Eq(5));
+  ASSERT_THAT(dary.to_string(), Eq("05 34 08 13 21 72 55 42"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedDAryHeap, KeepsHandlesValidAfterOtherRemovals) {
+  dary.remove(node21);
+  dary.delete_minimum();
+  auto node01 = dary.insert(1);
+  dary.decrease_key(node72, 6);
+  dary.remove(node01);
+
+  std::vector<int> keys;
+  while (!dary.empty()) keys.push_back(dary.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(6, 8, 13, 34, 42, 55, 88));
+}
+
+/*----------------------------------------------------------------------------*/
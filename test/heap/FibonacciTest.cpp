@@ -16,6 +16,9 @@
 /*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
 /******************************************************************************/
 
+// Standard headers
+#include <vector>
+
 // External headers
 #include "gmock/gmock.h"
 
@@ -24,12 +27,14 @@
 
 // Aliases
 using FibonacciHeap = heap::Fibonacci<int>;
+using ArenaFibonacciHeap = heap::ArenaFibonacci<int>;
 
 /*----------------------------------------------------------------------------*/
 /*                             USING DECLARATIONS                             */
 /*----------------------------------------------------------------------------*/
 
 using ::testing::Eq;
+using ::testing::ElementsAre;
 
 /*----------------------------------------------------------------------------*/
 /*                                  FIXTURES                                  */
@@ -64,6 +69,29 @@ struct AReorganizedFibonacciHeap : public ::testing::Test {
   // Final heap: (05 (08) (13 (21)) (34 (55) (42 (72)))) (88)
 };
 
+struct AReorganizedArenaFibonacciHeap : public ::testing::Test {
+  ArenaFibonacciHeap fib;
+  ArenaFibonacciHeap::node_ptr node03, node05, node08, node13,
+                               node21, node34, node55, node42,
+                               node24, node33, node72, node88;
+
+  AReorganizedArenaFibonacciHeap() : fib() {
+    node03 = fib.insert(3);
+    node05 = fib.insert(5);
+    node08 = fib.insert(8);
+    node13 = fib.insert(13);
+    node21 = fib.insert(21);
+    node34 = fib.insert(34);
+    node55 = fib.insert(55);
+    node42 = fib.insert(42);
+    node72 = fib.insert(72);
+    node88 = fib.insert(88);
+    fib.delete_minimum();  // To reorganize heap
+  }
+
+  // Final heap: (05 (08) (13 (21)) (34 (55) (42 (72)))) (88)
+};
+
 /*----------------------------------------------------------------------------*/
 /*                                SIMPLE TESTS                                */
 /*----------------------------------------------------------------------------*/
@@ -79,6 +107,17 @@ TEST(FibonacciHeap, CanBeEmptyConstructed) {
 
 /*----------------------------------------------------------------------------*/
 
+TEST(ArenaFibonacciHeap, CanBeEmptyConstructed) {
+  ArenaFibonacciHeap fib;
+
+  ASSERT_THAT(fib.size(), Eq(0u));
+  ASSERT_THAT(fib.empty(), Eq(true));
+  ASSERT_THAT(fib.get_minimum(), Eq(nullptr));
+  ASSERT_THAT(fib.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
 TEST(FibonacciHeap, CanBeConstructedWithOneElement) {
   FibonacciHeap fib {1};
 
@@ -88,6 +127,27 @@ TEST(FibonacciHeap, CanBeConstructedWithOneElement) {
   ASSERT_THAT(fib.to_string(), Eq("(01)"));
 }
 
+TEST(FibonacciHeap, CanBeConstructedFromIterators) {
+  std::vector<int> keys { 55, 34, 21, 13, 8, 5, 3 };
+  FibonacciHeap fib(keys.begin(), keys.end());
+
+  ASSERT_THAT(fib.size(), Eq(7u));
+  ASSERT_THAT(fib.find_minimum(), Eq(3));
+  ASSERT_THAT(fib.to_string(), Eq("(55) (34) (21) (13) (08) (05) (03)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ArenaFibonacciHeap, CanBeConstructedFromRange) {
+  std::vector<int> keys { 55, 34, 21, 13, 8, 5, 3 };
+  ArenaFibonacciHeap fib(keys);
+
+  std::vector<int> deleted;
+  while (!fib.empty()) deleted.push_back(fib.delete_minimum());
+
+  ASSERT_THAT(deleted, ElementsAre(3, 5, 8, 13, 21, 34, 55));
+}
+
 /*----------------------------------------------------------------------------*/
 /*                             TESTS WITH FIXTURE                             */
 /*----------------------------------------------------------------------------*/
@@ -198,6 +258,17 @@ TEST_F(AReorganizedFibonacciHeap, CanDecreaseKeyOfNonRootWithUnmarkedParent) {
 
 /*----------------------------------------------------------------------------*/
 
+TEST_F(AReorganizedFibonacciHeap, CanDecreaseKeyOfMiddleChild) {
+  fib.decrease_key(node13, 4);
+
+  ASSERT_THAT(fib.size(), Eq(9u));
+  ASSERT_THAT(fib.find_minimum(), Eq(4));
+  ASSERT_THAT(fib.to_string(),
+      Eq("(05 (08) (34 (55) (42 (72)))) (88) (04 (21))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
 TEST_F(AReorganizedFibonacciHeap, CanDecreaseKeyOfNonRootWithMarkedParent) {
   fib.decrease_key(node42, 7);
   fib.decrease_key(node55, 6);
@@ -229,3 +300,116 @@ TEST_F(AReorganizedFibonacciHeap, CanRemoveNonMinimumRootNode) {
 }
 
 /*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedFibonacciHeap, CanRemoveNonRootNode) {
+  fib.remove(node55);
+
+  ASSERT_THAT(fib.size(), Eq(8u));
+  ASSERT_THAT(fib.find_minimum(), Eq(5));
+  ASSERT_THAT(fib.to_string(), Eq("(05 (08) (13 (21)) (34* (42 (72)))) (88)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedFibonacciHeap, CanBeCleared) {
+  fib.clear();
+
+  ASSERT_THAT(fib.size(), Eq(0u));
+  ASSERT_THAT(fib.empty(), Eq(true));
+  ASSERT_THAT(fib.get_minimum(), Eq(nullptr));
+  ASSERT_THAT(fib.to_string(), Eq(""));
+  ASSERT_THAT(node72->key, Eq(72));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanDecreaseKeyWithMarkedParent) {
+  fib.decrease_key(node42, 7);
+  fib.decrease_key(node55, 6);
+
+  ASSERT_THAT(fib.size(), Eq(9u));
+  ASSERT_THAT(fib.find_minimum(), Eq(5));
+  ASSERT_THAT(fib.to_string(),
+      Eq("(05 (08) (13 (21))) (88) (07 (72)) (06) (34)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanRemoveNonRootNode) {
+  fib.remove(node55);
+
+  ASSERT_THAT(fib.size(), Eq(8u));
+  ASSERT_THAT(fib.find_minimum(), Eq(5));
+  ASSERT_THAT(fib.to_string(), Eq("(05 (08) (13 (21)) (34* (42 (72)))) (88)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanBeMergedWithCopiedHeap) {
+  ArenaFibonacciHeap oh {1, 2};
+  fib.merge(oh);
+
+  ASSERT_THAT(fib.size(), Eq(11u));
+  ASSERT_THAT(fib.find_minimum(), Eq(1));
+  ASSERT_THAT(oh.size(), Eq(2u));
+  ASSERT_THAT(oh.to_string(), Eq("(01) (02)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanBeMergedWithMovedHeap) {
+  ArenaFibonacciHeap oh {1, 2};
+  fib.merge(std::move(oh));
+
+  ASSERT_THAT(fib.size(), Eq(11u));
+  ASSERT_THAT(fib.find_minimum(), Eq(1));
+  ASSERT_THAT(fib.to_string(),
+      Eq("(05 (08) (13 (21)) (34 (55) (42 (72)))) (88) (01) (02)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanDeleteAllNodesInOrder) {
+  std::vector<int> keys;
+  while (!fib.empty()) keys.push_back(fib.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(5, 8, 13, 21, 34, 42, 55, 72, 88));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaFibonacciHeap, CanBeCleared) {
+  fib.clear();
+
+  ASSERT_THAT(fib.size(), Eq(0u));
+  ASSERT_THAT(fib.empty(), Eq(true));
+  ASSERT_THAT(fib.get_minimum(), Eq(nullptr));
+  ASSERT_THAT(fib.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AFibonacciHeap, CanInsertNodesInBulk) {
+  std::vector<int> keys { 40, 1, 2 };
+  fib.insert_bulk(keys.begin(), keys.end());
+
+  ASSERT_THAT(fib.size(), Eq(10u));
+  ASSERT_THAT(fib.find_minimum(), Eq(1));
+  ASSERT_THAT(fib.to_string(),
+              Eq("(03) (05) (08) (13) (21) (34) (55) (40) (01) (02)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedFibonacciHeap, CanInsertNodesInBulkAfterConsolidation) {
+  std::vector<int> keys { 40, 4, 90 };
+  fib.insert_bulk(keys.begin(), keys.end());
+
+  std::vector<int> deleted;
+  while (!fib.empty()) deleted.push_back(fib.delete_minimum());
+
+  ASSERT_THAT(deleted,
+              ElementsAre(4, 5, 8, 13, 21, 34, 40, 42, 55, 72, 88, 90));
+}
+
+/*----------------------------------------------------------------------------*/
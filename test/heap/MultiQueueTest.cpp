@@ -0,0 +1,145 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "heap/MultiQueue.hpp"
+
+// Aliases
+using MultiQueueHeap = heap::MultiQueue<int>;
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct AMultiQueueHeap : public ::testing::Test {
+  MultiQueueHeap queue { 4 };
+
+  AMultiQueueHeap() {
+    for (auto key : { 34, 5, 55, 13, 3, 21, 8 })
+      queue.insert(key);
+  }
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(MultiQueueHeap, CanBeEmptyConstructed) {
+  MultiQueueHeap queue;
+
+  int key = 0;
+  ASSERT_THAT(queue.size(), Eq(0u));
+  ASSERT_THAT(queue.empty(), Eq(true));
+  ASSERT_THAT(queue.try_delete_minimum(key), Eq(false));
+  ASSERT_THROW(queue.delete_minimum(), std::out_of_range);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(MultiQueueHeap, DeletesMinimumWithTwoInternalHeaps) {
+  // With two heaps, both are compared and the minimum key is found
+  MultiQueueHeap queue { 2 };
+  for (auto key : { 34, 5, 55, 13, 3, 21, 8 })
+    queue.insert(key);
+
+  ASSERT_THAT(queue.delete_minimum(), Eq(3));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(MultiQueueHeap, KeepsAllKeysWithConcurrentCallers) {
+  const int num_threads = 4, keys_per_thread = 10000;
+  MultiQueueHeap queue;
+
+  std::vector<std::thread> producers;
+  for (int t = 0; t < num_threads; t++) {
+    producers.emplace_back([&queue, t] {
+      for (int i = 0; i < keys_per_thread; i++)
+        queue.insert(t * keys_per_thread + i);
+    });
+  }
+
+  // Consumers run along with producers, until all keys are deleted
+  std::atomic<int> num_deleted(0);
+  std::vector<std::vector<int>> deleted(num_threads);
+  std::vector<std::thread> consumers;
+  for (int t = 0; t < num_threads; t++) {
+    consumers.emplace_back([&queue, &num_deleted, &deleted, t] {
+      int key;
+      while (num_deleted.load() < num_threads * keys_per_thread) {
+        if (!queue.try_delete_minimum(key)) continue;
+        deleted[t].push_back(key);
+        num_deleted++;
+      }
+    });
+  }
+
+  for (auto& thread : producers) thread.join();
+  for (auto& thread : consumers) thread.join();
+
+  std::vector<int> keys;
+  for (const auto& own : deleted)
+    keys.insert(keys.end(), own.begin(), own.end());
+  std::sort(keys.begin(), keys.end());
+
+  ASSERT_THAT(keys.size(), Eq(std::size_t(num_threads * keys_per_thread)));
+  for (int i = 0; i < num_threads * keys_per_thread; i++) {
+    ASSERT_THAT(keys[i], Eq(i));
+  }
+  ASSERT_THAT(queue.empty(), Eq(true));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AMultiQueueHeap, CanInsertANewKey) {
+  queue.insert(42);
+  ASSERT_THAT(queue.size(), Eq(8u));
+  ASSERT_THAT(queue.empty(), Eq(false));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AMultiQueueHeap, CanDeleteAllKeys) {
+  std::vector<int> keys;
+  while (!queue.empty())
+    keys.push_back(queue.delete_minimum());
+  std::sort(keys.begin(), keys.end());
+
+  ASSERT_THAT(keys, ElementsAre(3, 5, 8, 13, 21, 34, 55));
+}
+
+/*----------------------------------------------------------------------------*/
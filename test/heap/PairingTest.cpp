@@ -0,0 +1,323 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <vector>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Tested header
+#include "heap/Pairing.hpp"
+
+// Aliases
+using PairingHeap = heap::Pairing<int>;
+using ArenaPairingHeap = heap::ArenaPairing<int>;
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct APairingHeap : public ::testing::Test {
+  PairingHeap pairing { 3, 5, 8, 13, 21, 34, 55 };
+
+  // Final heap: (03 (55) (34) (21) (13) (08) (05))
+};
+
+struct AReorganizedPairingHeap : public ::testing::Test {
+  PairingHeap pairing;
+  PairingHeap::node_ptr node03, node05, node08, node13,
+                        node21, node34, node55, node42,
+                        node72, node88;
+
+  AReorganizedPairingHeap() : pairing() {
+    node03 = pairing.insert(3);
+    node05 = pairing.insert(5);
+    node08 = pairing.insert(8);
+    node13 = pairing.insert(13);
+    node21 = pairing.insert(21);
+    node34 = pairing.insert(34);
+    node55 = pairing.insert(55);
+    node42 = pairing.insert(42);
+    node72 = pairing.insert(72);
+    node88 = pairing.insert(88);
+    pairing.delete_minimum();  // To reorganize heap
+  }
+
+  // Final heap: (05 (72 (88)) (42 (55)) (21 (34)) (08 (13)))
+};
+
+struct AReorganizedArenaPairingHeap : public ::testing::Test {
+  ArenaPairingHeap pairing;
+  ArenaPairingHeap::node_ptr node05, node13, node42, node88;
+
+  AReorganizedArenaPairingHeap() : pairing() {
+    pairing.insert(3);
+    node05 = pairing.insert(5);
+    pairing.insert(8);
+    node13 = pairing.insert(13);
+    pairing.insert(21);
+    pairing.insert(34);
+    pairing.insert(55);
+    node42 = pairing.insert(42);
+    pairing.insert(72);
+    node88 = pairing.insert(88);
+    pairing.delete_minimum();  // To reorganize heap
+  }
+
+  // Final heap: (05 (72 (88)) (42 (55)) (21 (34)) (08 (13)))
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(PairingHeap, CanBeEmptyConstructed) {
+  PairingHeap pairing;
+
+  ASSERT_THAT(pairing.size(), Eq(0u));
+  ASSERT_THAT(pairing.empty(), Eq(true));
+  ASSERT_THAT(pairing.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(PairingHeap, CanBeConstructedWithOneElement) {
+  PairingHeap pairing {1};
+
+  ASSERT_THAT(pairing.size(), Eq(1u));
+  ASSERT_THAT(pairing.empty(), Eq(false));
+  ASSERT_THAT(pairing.find_minimum(), Eq(1));
+  ASSERT_THAT(pairing.to_string(), Eq("(01)"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(PairingHeap, CanBeConstructedWithUnorderedElements) {
+  PairingHeap pairing { 55, 3, 21, 13, 8, 5, 34 };
+
+  ASSERT_THAT(pairing.size(), Eq(7u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(3));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(03 (34) (05) (08) (13) (21) (55))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(PairingHeap, CanBeCopiedWhenDeeplyNested) {
+  PairingHeap pairing;
+  for (int key = 100000; key > 0; key--)
+    pairing.insert(key);
+
+  PairingHeap copy(pairing);
+
+  std::vector<int> keys;
+  while (!copy.empty()) keys.push_back(copy.delete_minimum());
+
+  ASSERT_THAT(keys.size(), Eq(100000u));
+  ASSERT_THAT(keys.front(), Eq(1));
+  ASSERT_THAT(keys.back(), Eq(100000));
+  ASSERT_THAT(pairing.size(), Eq(100000u));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(APairingHeap, CanInsertANewNode) {
+  pairing.insert(1);
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(1));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(01 (03 (55) (34) (21) (13) (08) (05)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(APairingHeap, CanBeMergedWithCopiedPairingHeap) {
+  PairingHeap oh {1};
+  pairing.merge(oh);
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(1));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(01 (03 (55) (34) (21) (13) (08) (05)))"));
+  ASSERT_THAT(oh.size(), Eq(1u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(APairingHeap, CanBeMergedWithMovedPairingHeap) {
+  PairingHeap oh {1};
+  pairing.merge(std::move(oh));
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(1));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(01 (03 (55) (34) (21) (13) (08) (05)))"));
+  ASSERT_THAT(oh.size(), Eq(0u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(APairingHeap, CanDeleteMinimumElement) {
+  auto deleted_key = pairing.delete_minimum();
+
+  ASSERT_THAT(deleted_key, Eq(3));
+
+  ASSERT_THAT(pairing.size(), Eq(6u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(5));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(05 (34 (55)) (13 (21)) (08))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(APairingHeap, CanBeCleared) {
+  pairing.clear();
+
+  ASSERT_THAT(pairing.size(), Eq(0u));
+  ASSERT_THAT(pairing.empty(), Eq(true));
+  ASSERT_THAT(pairing.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanDecreaseKeyOfMinimum) {
+  pairing.decrease_key(node05, 2);
+
+  ASSERT_THAT(pairing.size(), Eq(9u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(2));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(02 (72 (88)) (42 (55)) (21 (34)) (08 (13)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanDecreaseKeyOfFirstChild) {
+  pairing.decrease_key(node72, 7);
+
+  ASSERT_THAT(pairing.size(), Eq(9u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(5));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(05 (07 (88)) (42 (55)) (21 (34)) (08 (13)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanDecreaseKeyOfInnerNode) {
+  pairing.decrease_key(node55, 7);
+
+  ASSERT_THAT(pairing.size(), Eq(9u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(5));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(05 (07) (72 (88)) (42) (21 (34)) (08 (13)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, ThrowsWhenNodeKeyIsBiggerThanCurrentKey) {
+  ASSERT_THROW(pairing.decrease_key(node88, 90), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanDecreaseKeyChangingMinimum) {
+  pairing.decrease_key(node13, 0);
+
+  ASSERT_THAT(pairing.size(), Eq(9u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(0));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(00 (05 (72 (88)) (42 (55)) (21 (34)) (08)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanRemoveMinimum) {
+  pairing.remove(node05);
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(8));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(08 (42 (72 (88)) (55)) (21 (34)) (13))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, CanRemoveNonRootNode) {
+  pairing.remove(node42);
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(5));
+  ASSERT_THAT(pairing.to_string(),
+              Eq("(05 (55) (72 (88)) (21 (34)) (08 (13)))"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedPairingHeap, KeepsHandlesValidAfterOtherRemovals) {
+  pairing.remove(node21);
+  pairing.delete_minimum();
+  auto node01 = pairing.insert(1);
+  pairing.decrease_key(node72, 6);
+  pairing.remove(node01);
+
+  std::vector<int> keys;
+  while (!pairing.empty()) keys.push_back(pairing.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(6, 8, 13, 34, 42, 55, 88));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaPairingHeap, CanDecreaseKeyAndRemoveNodes) {
+  pairing.decrease_key(node88, 1);
+  pairing.remove(node42);
+  pairing.decrease_key(node13, 2);
+
+  ASSERT_THAT(pairing.size(), Eq(8u));
+  ASSERT_THAT(pairing.delete_minimum(), Eq(1));
+  ASSERT_THAT(pairing.delete_minimum(), Eq(2));
+  ASSERT_THAT(pairing.delete_minimum(), Eq(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedArenaPairingHeap, CanBeMergedWithMovedPairingHeap) {
+  ArenaPairingHeap oh { 1, 4 };
+  pairing.merge(std::move(oh));
+
+  ASSERT_THAT(pairing.size(), Eq(11u));
+  ASSERT_THAT(pairing.find_minimum(), Eq(1));
+  ASSERT_THAT(oh.size(), Eq(0u));
+
+  std::vector<int> keys;
+  while (!pairing.empty()) keys.push_back(pairing.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(1, 4, 5, 8, 13, 21, 34, 42, 55, 72, 88));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,235 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <vector>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "graph/Edge.hpp"
+
+// Tested header
+#include "heap/Radix.hpp"
+
+// Aliases
+using RadixHeap = heap::Radix<int>;
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+struct ARadixHeap : public ::testing::Test {
+  RadixHeap radix { 3, 5, 8, 13, 21, 34, 55 };
+
+  // Final heap: 03 05 08 13 21 34 55
+};
+
+struct AReorganizedRadixHeap : public ::testing::Test {
+  RadixHeap radix { 3, 5, 8, 13, 21, 34, 55, 42, 72, 88 };
+
+  AReorganizedRadixHeap() {
+    radix.delete_minimum();  // To reorganize heap
+  }
+
+  // Final heap: 05 08 13 21 34 55 42 72 88
+};
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanBeEmptyConstructed) {
+  RadixHeap radix;
+
+  ASSERT_THAT(radix.size(), Eq(0u));
+  ASSERT_THAT(radix.empty(), Eq(true));
+  ASSERT_THAT(radix.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanBeConstructedWithOneElement) {
+  RadixHeap radix {1};
+
+  ASSERT_THAT(radix.size(), Eq(1u));
+  ASSERT_THAT(radix.empty(), Eq(false));
+  ASSERT_THAT(radix.find_minimum(), Eq(1));
+  ASSERT_THAT(radix.to_string(), Eq("01"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanBeConstructedWithUnorderedElements) {
+  RadixHeap radix { 55, 34, 21, 13, 8, 5, 3 };
+
+  std::vector<int> keys;
+  while (!radix.empty()) keys.push_back(radix.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(3, 5, 8, 13, 21, 34, 55));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanStoreNegativeKeys) {
+  RadixHeap radix { 5, -3, 0, -8, 2 };
+
+  std::vector<int> keys;
+  while (!radix.empty()) keys.push_back(radix.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(-8, -3, 0, 2, 5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanStoreFloatingPointKeys) {
+  heap::Radix<double> radix { 2.5, -1.25, 0.0, 1e300, -0.0, 0.5, 1e-300 };
+
+  std::vector<double> keys;
+  while (!radix.empty()) keys.push_back(radix.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(-1.25, 0.0, 0.0, 1e-300, 0.5, 2.5, 1e300));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(RadixHeap, CanStoreEdgesOrderedByWeight) {
+  heap::Radix<graph::Edge> radix {
+    graph::Edge{0, 7.0}, graph::Edge{1, 2.0}, graph::Edge{2, 5.0}
+  };
+
+  ASSERT_THAT(radix.delete_minimum(), Eq(graph::Edge{1, 2.0}));
+  ASSERT_THAT(radix.delete_minimum(), Eq(graph::Edge{2, 5.0}));
+  ASSERT_THAT(radix.delete_minimum(), Eq(graph::Edge{0, 7.0}));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanInsertANewNode) {
+  radix.insert(1);
+
+  ASSERT_THAT(radix.size(), Eq(8u));
+  ASSERT_THAT(radix.find_minimum(), Eq(1));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanBeMergedWithCopiedRadixHeap) {
+  RadixHeap oh {1};
+  radix.merge(oh);
+
+  ASSERT_THAT(radix.size(), Eq(8u));
+  ASSERT_THAT(radix.find_minimum(), Eq(1));
+  ASSERT_THAT(oh.size(), Eq(1u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanBeMergedWithMovedRadixHeap) {
+  RadixHeap oh {1};
+  radix.merge(std::move(oh));
+
+  ASSERT_THAT(radix.size(), Eq(8u));
+  ASSERT_THAT(radix.find_minimum(), Eq(1));
+  ASSERT_THAT(oh.size(), Eq(0u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanBeMergedWithItself) {
+  radix.merge(radix);
+
+  ASSERT_THAT(radix.size(), Eq(14u));
+  ASSERT_THAT(radix.delete_minimum(), Eq(3));
+  ASSERT_THAT(radix.delete_minimum(), Eq(3));
+  ASSERT_THAT(radix.delete_minimum(), Eq(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanDeleteMinimumElement) {
+  auto deleted_key = radix.delete_minimum();
+
+  ASSERT_THAT(deleted_key, Eq(3));
+
+  ASSERT_THAT(radix.size(), Eq(6u));
+  ASSERT_THAT(radix.find_minimum(), Eq(5));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(ARadixHeap, CanBeCleared) {
+  radix.clear();
+
+  ASSERT_THAT(radix.size(), Eq(0u));
+  ASSERT_THAT(radix.empty(), Eq(true));
+  ASSERT_THAT(radix.to_string(), Eq(""));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedRadixHeap, KeepsKeysInBucketsAfterDeletion) {
+  ASSERT_THAT(radix.size(), Eq(9u));
+  ASSERT_THAT(radix.to_string(), Eq("05 08 13 21 34 55 42 72 88"));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedRadixHeap, CanInsertKeyEqualToLastMinimum) {
+  radix.insert(3);
+
+  ASSERT_THAT(radix.size(), Eq(10u));
+  ASSERT_THAT(radix.find_minimum(), Eq(3));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedRadixHeap, ThrowsWhenKeyIsSmallerThanLastMinimum) {
+  ASSERT_THROW(radix.insert(2), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedRadixHeap, ThrowsWhenKeyIsSmallerThanFoundMinimum) {
+  radix.find_minimum();
+  ASSERT_THROW(radix.insert(4), std::invalid_argument);
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST_F(AReorganizedRadixHeap, CanDeleteAllElementsInOrder) {
+  radix.insert(60);
+  radix.insert(5);
+
+  std::vector<int> keys;
+  while (!radix.empty()) keys.push_back(radix.delete_minimum());
+
+  ASSERT_THAT(keys, ElementsAre(5, 5, 8, 13, 21, 34, 42, 55, 60, 72, 88));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,169 @@
+/******************************************************************************/
+/*   Heaps - a heap library implementing heaps to compare their performance   */
+/*   Copyright (C) 2016 Renato Cordeiro Ferreira                              */
+/*                                                                            */
+/*   This program is free software: you can redistribute it and/or modify     */
+/*   it under the terms of the GNU General Public License as published by     */
+/*   the Free Software Foundation, either version 3 of the License, or        */
+/*   (at your option) any later version.                                      */
+/*                                                                            */
+/*   This program is distributed in the hope that it will be useful,          */
+/*   but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/*   GNU General Public License for more details.                             */
+/*                                                                            */
+/*   You should have received a copy of the GNU General Public License        */
+/*   along with this program.  If not, see <www.gnu.org/licenses/>.           */
+/******************************************************************************/
+
+// Standard headers
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// External headers
+#include "gmock/gmock.h"
+
+// Internal headers
+#include "heap/DAry.hpp"
+
+// Tested header
+#include "heap/Simd.hpp"
+
+/*----------------------------------------------------------------------------*/
+/*                             USING DECLARATIONS                             */
+/*----------------------------------------------------------------------------*/
+
+using ::testing::Eq;
+using ::testing::ContainerEq;
+
+/*----------------------------------------------------------------------------*/
+/*                                  FIXTURES                                  */
+/*----------------------------------------------------------------------------*/
+
+template<typename K>
+struct AGroupOfChildren : public ::testing::Test {
+  std::mt19937 rng;
+
+  // Few distinct values, so that ties are common
+  std::vector<K> random_keys(std::size_t count) {
+    std::uniform_int_distribution<int> distribution(-4, 4);
+    std::vector<K> keys;
+    for (std::size_t i = 0; i < count; i++)
+      keys.push_back(static_cast<K>(distribution(rng)));
+    return keys;
+  }
+
+  template<std::size_t N>
+  void expect_same_index_as_scalar_search() {
+    for (int round = 0; round < 1000; round++) {
+      auto keys = random_keys(N);
+      for (std::size_t count = 1; count <= N; count++) {
+        ASSERT_THAT((heap::simd::min_index<K, std::less<K>, N>(
+                       keys.data(), count)),
+                    Eq((heap::simd::scalar_min_index<K, std::less<K>>(
+                       keys.data(), count))));
+      }
+    }
+  }
+};
+
+using ArithmeticKeys
+  = ::testing::Types<double, float, std::int32_t, std::uint32_t>;
+TYPED_TEST_CASE(AGroupOfChildren, ArithmeticKeys);
+
+/*----------------------------------------------------------------------------*/
+/*                                SIMPLE TESTS                                */
+/*----------------------------------------------------------------------------*/
+
+TEST(ScalarMinIndex, FindsFirstMinimum) {
+  std::vector<int> keys { 5, 3, 8, 3, 9 };
+  ASSERT_THAT((heap::simd::scalar_min_index<int, std::less<int>>(
+                 keys.data(), keys.size())), Eq(1u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(ScalarMinIndex, RespectsComparator) {
+  std::vector<int> keys { 5, 3, 9, 8, 9 };
+  ASSERT_THAT((heap::simd::scalar_min_index<int, std::greater<int>>(
+                 keys.data(), keys.size())), Eq(2u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(MinIndex, ComparesUnsignedIntegersAboveSignedRange) {
+  std::vector<std::uint32_t> keys(8, 4000000000u);
+  keys[5] = 3000000000u;
+  ASSERT_THAT((heap::simd::min_index<std::uint32_t,
+                                     std::less<std::uint32_t>, 8>(
+                 keys.data(), keys.size())), Eq(5u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(MinIndex, ComparesNegativeIntegers) {
+  std::vector<std::int32_t> keys(16, 0);
+  keys[11] = -7;
+  keys[14] = -7;
+  ASSERT_THAT((heap::simd::min_index<std::int32_t,
+                                     std::less<std::int32_t>, 16>(
+                 keys.data(), keys.size())), Eq(11u));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AWideDAryHeap, DeletesDoublesInOrder) {
+  std::mt19937 rng;
+  std::uniform_real_distribution<double> distribution(0.0, 100.0);
+
+  heap::DAry16<double> dary;
+  std::vector<double> keys;
+  for (int i = 0; i < 5000; i++) {
+    keys.push_back(distribution(rng));
+    dary.insert(keys.back());
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<double> deleted;
+  while (!dary.empty()) deleted.push_back(dary.delete_minimum());
+
+  ASSERT_THAT(deleted, ContainerEq(keys));
+}
+
+/*----------------------------------------------------------------------------*/
+
+TEST(AWideDAryHeap, DeletesIntegersInOrder) {
+  std::mt19937 rng;
+  std::uniform_int_distribution<int> distribution(-1000, 1000);
+
+  heap::DAry8<int> dary;
+  std::vector<int> keys;
+  for (int i = 0; i < 5000; i++) {
+    keys.push_back(distribution(rng));
+    dary.insert(keys.back());
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<int> deleted;
+  while (!dary.empty()) deleted.push_back(dary.delete_minimum());
+
+  ASSERT_THAT(deleted, ContainerEq(keys));
+}
+
+/*----------------------------------------------------------------------------*/
+/*                             TESTS WITH FIXTURE                             */
+/*----------------------------------------------------------------------------*/
+
+TYPED_TEST(AGroupOfChildren, HasSameMinimumAsScalarSearchWith8Children) {
+  this->template expect_same_index_as_scalar_search<8>();
+}
+
+/*----------------------------------------------------------------------------*/
+
+TYPED_TEST(AGroupOfChildren, HasSameMinimumAsScalarSearchWith16Children) {
+  this->template expect_same_index_as_scalar_search<16>();
+}
+
+/*----------------------------------------------------------------------------*/